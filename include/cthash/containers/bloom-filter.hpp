@@ -0,0 +1,397 @@
+#ifndef CTHASH_CONTAINERS_BLOOM_FILTER_HPP
+#define CTHASH_CONTAINERS_BLOOM_FILTER_HPP
+
+#include "../value.hpp"
+#include "../internal/convert.hpp"
+#include "../internal/prefetch.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <optional>
+#include <span>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+
+namespace cthash {
+
+namespace internal {
+
+	// read `count` bits from digest starting at bit `offset` (MSB first), no hashing is needed as digest is already uniform
+	template <typename Value> constexpr auto digest_bits(const Value & value, size_t offset, size_t count) noexcept -> uint64_t {
+		assert(count != 0u && count <= 57u);
+		assert((offset + count) <= value.size() * 8u);
+
+		const size_t first_byte = offset / 8u;
+		const size_t last_byte = (offset + count - 1u) / 8u;
+
+		uint64_t acc = 0u;
+		for (size_t i = first_byte; i <= last_byte; ++i) {
+			acc = (acc << 8u) | static_cast<uint64_t>(value[i]);
+		}
+
+		const size_t unused_low_bits = 7u - ((offset + count - 1u) % 8u);
+		return (acc >> unused_low_bits) bitand ((uint64_t{1u} << count) - 1u);
+	}
+
+	// one cache-line
+	struct alignas(64) bloom_block {
+		std::array<uint64_t, 8> words{};
+	};
+
+	struct owned_bloom_storage {
+		std::vector<bloom_block> blocks;
+
+		constexpr owned_bloom_storage() noexcept = default;
+		explicit constexpr owned_bloom_storage(size_t words): blocks(words / 8u) { }
+
+		constexpr auto size() const noexcept -> size_t {
+			return blocks.size() * 8u;
+		}
+
+		constexpr auto word(size_t index) const noexcept -> uint64_t {
+			return blocks[index / 8u].words[index % 8u];
+		}
+
+		constexpr void set(size_t index, uint64_t mask) noexcept {
+			blocks[index / 8u].words[index % 8u] |= mask;
+		}
+
+		constexpr void prefetch(size_t index) const noexcept {
+			internal::prefetch(&blocks[index / 8u]);
+		}
+	};
+
+	// words from serialized filter (eg. mmaped file), they are stored as little-endian
+	struct serialized_bloom_storage {
+		std::span<const std::byte> bytes;
+
+		constexpr auto size() const noexcept -> size_t {
+			return bytes.size() / 8u;
+		}
+
+		constexpr auto word(size_t index) const noexcept -> uint64_t {
+			return cast_from_le_bytes<uint64_t>(bytes.subspan(index * 8u).template first<8u>());
+		}
+
+		constexpr void prefetch(size_t index) const noexcept {
+			internal::prefetch(bytes.data() + index * 8u);
+		}
+	};
+
+} // namespace internal
+
+// bits of digest are split into k disjoint ranges, each range selects one bit in the filter
+struct standard_bloom_layout {
+	static constexpr uint32_t id = 0u;
+	static constexpr unsigned min_log2_size = 9u; // one block
+
+	static constexpr auto words_for(unsigned log2_bits) noexcept -> size_t {
+		return (size_t{1u} << log2_bits) / 64u;
+	}
+
+	static constexpr auto bits_needed(unsigned log2_bits, unsigned hashes) noexcept -> size_t {
+		return size_t{log2_bits} * hashes;
+	}
+
+	template <typename Value, typename Fn> static constexpr void for_each_bit(const Value & value, unsigned log2_bits, unsigned hashes, Fn && fn) {
+		for (unsigned i = 0; i != hashes; ++i) {
+			const uint64_t bit = internal::digest_bits(value, size_t{i} * log2_bits, log2_bits);
+			fn(static_cast<size_t>(bit / 64u), uint64_t{1u} << (bit % 64u));
+		}
+	}
+
+	template <typename Value, typename Storage> static constexpr void prefetch(const Value & value, unsigned log2_bits, unsigned hashes, const Storage & storage) noexcept {
+		for_each_bit(value, log2_bits, hashes, [&](size_t word, uint64_t) { storage.prefetch(word); });
+	}
+};
+
+// first bits of digest select a cache-line sized block, all k bits are then set inside it (9 bits of digest each)
+struct blocked_bloom_layout {
+	static constexpr uint32_t id = 1u;
+	static constexpr unsigned min_log2_size = 0u;
+	static constexpr unsigned bits_per_probe = 9u;
+
+	static constexpr auto words_for(unsigned log2_blocks) noexcept -> size_t {
+		return (size_t{1u} << log2_blocks) * 8u;
+	}
+
+	static constexpr auto bits_needed(unsigned log2_blocks, unsigned hashes) noexcept -> size_t {
+		return size_t{log2_blocks} + size_t{hashes} * bits_per_probe;
+	}
+
+	template <typename Value> static constexpr auto block_of(const Value & value, unsigned log2_blocks) noexcept -> size_t {
+		return (log2_blocks != 0u) ? static_cast<size_t>(internal::digest_bits(value, 0u, log2_blocks)) : 0u;
+	}
+
+	template <typename Value, typename Fn> static constexpr void for_each_bit(const Value & value, unsigned log2_blocks, unsigned hashes, Fn && fn) {
+		const size_t first_word = block_of(value, log2_blocks) * 8u;
+
+		for (unsigned i = 0; i != hashes; ++i) {
+			const uint64_t bit = internal::digest_bits(value, log2_blocks + size_t{i} * bits_per_probe, bits_per_probe);
+			fn(first_word + static_cast<size_t>(bit / 64u), uint64_t{1u} << (bit % 64u));
+		}
+	}
+
+	template <typename Value, typename Storage> static constexpr void prefetch(const Value & value, unsigned log2_blocks, unsigned, const Storage & storage) noexcept {
+		storage.prefetch(block_of(value, log2_blocks) * 8u);
+	}
+};
+
+// serialized form: 64 bytes of header (all numbers are little-endian) followed by filter's words (little-endian uint64)
+//   0: "cthbloom"
+//   8: u32 version
+//  12: u32 layout (0 = standard, 1 = blocked)
+//  16: u32 digest length (in bytes)
+//  20: u32 log2 of size (bits for standard, blocks for blocked layout)
+//  24: u32 number of hashes
+//  28: u32 reserved (zero)
+//  32: u64 number of words
+//  40: reserved (zeros)
+// header is 64 bytes long so words stay cache-line aligned when the file is mapped to memory
+struct bloom_filter_header {
+	static constexpr size_t size = 64u;
+	static constexpr uint32_t current_version = 1u;
+	static constexpr auto magic = std::array<char, 8>{'c', 't', 'h', 'b', 'l', 'o', 'o', 'm'};
+
+	uint32_t version{current_version};
+	uint32_t layout{0u};
+	uint32_t digest_length{0u};
+	uint32_t log2_size{0u};
+	uint32_t hashes{0u};
+	uint64_t words{0u};
+
+	constexpr void write_into(std::span<std::byte, size> out) const noexcept {
+		std::fill(out.begin(), out.end(), std::byte{0});
+		std::transform(magic.begin(), magic.end(), out.begin(), [](char c) { return static_cast<std::byte>(c); });
+		unwrap_littleendian_number<uint32_t>{out.subspan<8u, 4u>()} = version;
+		unwrap_littleendian_number<uint32_t>{out.subspan<12u, 4u>()} = layout;
+		unwrap_littleendian_number<uint32_t>{out.subspan<16u, 4u>()} = digest_length;
+		unwrap_littleendian_number<uint32_t>{out.subspan<20u, 4u>()} = log2_size;
+		unwrap_littleendian_number<uint32_t>{out.subspan<24u, 4u>()} = hashes;
+		unwrap_littleendian_number<uint64_t>{out.subspan<32u, 8u>()} = words;
+	}
+
+	static constexpr auto read_from(std::span<const std::byte> in) noexcept -> std::optional<bloom_filter_header> {
+		if (in.size() < size) {
+			return std::nullopt;
+		}
+
+		if (!std::equal(magic.begin(), magic.end(), in.begin(), [](char c, std::byte b) { return static_cast<std::byte>(c) == b; })) {
+			return std::nullopt;
+		}
+
+		bloom_filter_header output{};
+		output.version = cast_from_le_bytes<uint32_t>(in.subspan<8u, 4u>());
+		output.layout = cast_from_le_bytes<uint32_t>(in.subspan<12u, 4u>());
+		output.digest_length = cast_from_le_bytes<uint32_t>(in.subspan<16u, 4u>());
+		output.log2_size = cast_from_le_bytes<uint32_t>(in.subspan<20u, 4u>());
+		output.hashes = cast_from_le_bytes<uint32_t>(in.subspan<24u, 4u>());
+		output.words = cast_from_le_bytes<uint64_t>(in.subspan<32u, 8u>());
+
+		if (output.version != current_version) {
+			return std::nullopt;
+		}
+
+		return output;
+	}
+};
+
+template <typename Value, typename Layout, typename Storage = internal::owned_bloom_storage> class basic_digest_bloom_filter {
+	template <typename, typename, typename> friend class basic_digest_bloom_filter;
+
+	static constexpr size_t digest_bits = Value{}.size() * 8u;
+	static constexpr bool owning = std::same_as<Storage, internal::owned_bloom_storage>;
+
+	Storage storage{};
+	unsigned log2_size{0u};
+	unsigned hashes{0u};
+
+	constexpr basic_digest_bloom_filter(Storage s, unsigned log2, unsigned k) noexcept: storage{std::move(s)}, log2_size{log2}, hashes{k} { }
+
+public:
+	using value_type = Value;
+	using layout = Layout;
+
+	static constexpr bool valid_parameters(unsigned log2, unsigned k) noexcept {
+		return log2 >= Layout::min_log2_size && log2 < 48u && k != 0u && Layout::bits_needed(log2, k) <= digest_bits;
+	}
+
+	// pick size and number of hashes for expected number of items and false positive probability
+	static auto for_capacity(size_t items, double false_positive_rate) -> basic_digest_bloom_filter
+		requires(owning)
+	{
+		assert(false_positive_rate > 0.0 && false_positive_rate < 1.0);
+		constexpr double ln2 = 0.69314718055994530942;
+
+		const double bits = std::max(512.0, -static_cast<double>(std::max(items, size_t{1u})) * std::log(false_positive_rate) / (ln2 * ln2));
+		unsigned log2_bits = static_cast<unsigned>(std::ceil(std::log2(bits)));
+		unsigned k = std::max(1u, static_cast<unsigned>(std::lround(-std::log2(false_positive_rate))));
+
+		// blocked layout addresses blocks of 512 bits
+		unsigned log2 = std::max(Layout::min_log2_size, (Layout::id == blocked_bloom_layout::id) ? (log2_bits - 9u) : log2_bits);
+
+		// we can't use more bits than digest has
+		while (k > 1u && !valid_parameters(log2, k)) {
+			--k;
+		}
+
+		return basic_digest_bloom_filter(log2, k);
+	}
+
+	constexpr basic_digest_bloom_filter() noexcept = default;
+
+	// log2 is size of filter in bits (standard layout) or in 512 bit blocks (blocked layout)
+	constexpr basic_digest_bloom_filter(unsigned log2, unsigned k)
+		requires(owning)
+		: storage(Layout::words_for(log2)), log2_size{log2}, hashes{k} {
+		assert(valid_parameters(log2, k));
+	}
+
+	constexpr auto size_in_bits() const noexcept -> size_t {
+		return storage.size() * 64u;
+	}
+
+	constexpr auto number_of_hashes() const noexcept -> unsigned {
+		return hashes;
+	}
+
+	constexpr void insert(const Value & value) noexcept
+		requires(owning)
+	{
+		Layout::for_each_bit(value, log2_size, hashes, [&](size_t word, uint64_t mask) { storage.set(word, mask); });
+	}
+
+	constexpr void insert(std::span<const Value> values) noexcept
+		requires(owning)
+	{
+		constexpr size_t window = 8u;
+
+		while (!values.empty()) {
+			const auto current = values.first(std::min(window, values.size()));
+
+			for (const Value & v: current) {
+				Layout::prefetch(v, log2_size, hashes, storage);
+			}
+
+			for (const Value & v: current) {
+				insert(v);
+			}
+
+			values = values.subspan(current.size());
+		}
+	}
+
+	constexpr bool contains(const Value & value) const noexcept {
+		bool result = true;
+		Layout::for_each_bit(value, log2_size, hashes, [&](size_t word, uint64_t mask) { result &= ((storage.word(word) bitand mask) != 0u); });
+		return result;
+	}
+
+	// batch query, memory for next few values is prefetched before they are tested, returns number of positive results
+	constexpr auto contains(std::span<const Value> values, std::span<bool> results) const noexcept -> size_t {
+		assert(results.size() >= values.size());
+		constexpr size_t window = 8u;
+
+		size_t positives = 0u;
+
+		while (!values.empty()) {
+			const auto current = values.first(std::min(window, values.size()));
+
+			for (const Value & v: current) {
+				Layout::prefetch(v, log2_size, hashes, storage);
+			}
+
+			for (const Value & v: current) {
+				const bool r = contains(v);
+				positives += static_cast<size_t>(r);
+				results.front() = r;
+				results = results.subspan(1u);
+			}
+
+			values = values.subspan(current.size());
+		}
+
+		return positives;
+	}
+
+	// serialization
+	constexpr auto header() const noexcept -> bloom_filter_header {
+		bloom_filter_header h{};
+		h.layout = Layout::id;
+		h.digest_length = static_cast<uint32_t>(Value{}.size());
+		h.log2_size = log2_size;
+		h.hashes = hashes;
+		h.words = storage.size();
+		return h;
+	}
+
+	constexpr auto serialized_size() const noexcept -> size_t {
+		return bloom_filter_header::size + storage.size() * 8u;
+	}
+
+	constexpr void serialize_into(std::span<std::byte> out) const noexcept {
+		assert(out.size() >= serialized_size());
+		header().write_into(out.template first<bloom_filter_header::size>());
+		out = out.subspan(bloom_filter_header::size);
+
+		for (size_t i = 0; i != storage.size(); ++i) {
+			unwrap_littleendian_number<uint64_t>{out.subspan(i * 8u).template first<8u>()} = storage.word(i);
+		}
+	}
+
+	constexpr auto serialize() const -> std::vector<std::byte> {
+		std::vector<std::byte> output(serialized_size());
+		serialize_into(output);
+		return output;
+	}
+
+	// filter referencing serialized bytes directly (no copy, bytes must outlive the view)
+	static constexpr auto view(std::span<const std::byte> in) noexcept -> std::optional<basic_digest_bloom_filter<Value, Layout, internal::serialized_bloom_storage>> {
+		const auto h = bloom_filter_header::read_from(in);
+
+		if (!h || h->layout != Layout::id || h->digest_length != Value{}.size() || !valid_parameters(h->log2_size, h->hashes) || h->words != Layout::words_for(h->log2_size)) {
+			return std::nullopt;
+		}
+
+		const auto words = in.subspan(bloom_filter_header::size);
+
+		const size_t words_size = static_cast<size_t>(h->words) * 8u;
+
+		if (words.size() < words_size) {
+			return std::nullopt;
+		}
+
+		return basic_digest_bloom_filter<Value, Layout, internal::serialized_bloom_storage>(internal::serialized_bloom_storage{words.first(words_size)}, h->log2_size, h->hashes);
+	}
+
+	// copy of serialized filter
+	static constexpr auto load(std::span<const std::byte> in) -> std::optional<basic_digest_bloom_filter>
+		requires(owning)
+	{
+		const auto v = view(in);
+
+		if (!v) {
+			return std::nullopt;
+		}
+
+		auto output = basic_digest_bloom_filter(v->log2_size, v->hashes);
+
+		for (size_t i = 0; i != v->storage.size(); ++i) {
+			output.storage.set(i, v->storage.word(i));
+		}
+
+		return output;
+	}
+};
+
+template <typename Value> using digest_bloom_filter = basic_digest_bloom_filter<Value, standard_bloom_layout>;
+template <typename Value> using blocked_digest_bloom_filter = basic_digest_bloom_filter<Value, blocked_bloom_layout>;
+
+template <typename Value> using digest_bloom_filter_view = basic_digest_bloom_filter<Value, standard_bloom_layout, internal::serialized_bloom_storage>;
+template <typename Value> using blocked_digest_bloom_filter_view = basic_digest_bloom_filter<Value, blocked_bloom_layout, internal::serialized_bloom_storage>;
+
+} // namespace cthash
+
+#endif
@@ -0,0 +1,593 @@
+#ifndef CTHASH_CONTAINERS_DIGEST_SET_HPP
+#define CTHASH_CONTAINERS_DIGEST_SET_HPP
+
+#include "../value.hpp"
+#include "../internal/convert.hpp"
+#include "../internal/prefetch.hpp"
+#include <algorithm>
+#include <bit>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <cassert>
+#include <cstdint>
+
+namespace cthash {
+
+namespace internal {
+
+	// swiss-table style group of control bytes, all bytes of a group are probed at once (SWAR)
+	struct control_group {
+		static constexpr size_t width = 8u;
+
+		static constexpr uint8_t empty = 0b1000'0000u;
+		static constexpr uint8_t deleted = 0b1111'1110u;
+
+		static constexpr uint64_t lsbs = 0x0101'0101'0101'0101ull;
+		static constexpr uint64_t msbs = 0x8080'8080'8080'8080ull;
+
+		uint64_t ctrl;
+
+		static constexpr auto load(const uint8_t * ptr) noexcept -> control_group {
+			return {cast_from_le_bytes<uint64_t>(std::span<const uint8_t, width>(ptr, width))};
+		}
+
+		// each returned mask has MSB of byte set for matching positions (can contain false positives)
+		constexpr auto match(uint8_t h2) const noexcept -> uint64_t {
+			const uint64_t x = ctrl xor (lsbs * h2);
+			return (x - lsbs) bitand ~x bitand msbs;
+		}
+
+		constexpr auto match_empty() const noexcept -> uint64_t {
+			return ctrl bitand ~(ctrl << 6u) bitand msbs;
+		}
+
+		constexpr auto match_empty_or_deleted() const noexcept -> uint64_t {
+			return ctrl bitand msbs;
+		}
+
+		static constexpr auto lowest(uint64_t mask) noexcept -> size_t {
+			return static_cast<size_t>(std::countr_zero(mask)) / 8u;
+		}
+	};
+
+	template <typename Value> concept digest_with_fingerprint = requires(const Value & val) {
+		{ val.fingerprint() } -> std::unsigned_integral;
+		{ val == val } -> std::same_as<bool>;
+	};
+
+	// common implementation of open addressing table, Slot is stored inline, KeyOf extracts digest from it
+	template <digest_with_fingerprint Value, typename Slot, typename KeyOf> class digest_table {
+	public:
+		using key_type = Value;
+		using slot_type = Slot;
+		using size_type = size_t;
+
+		static constexpr size_t group_width = control_group::width;
+		static constexpr size_t min_groups = 2u;
+
+		template <bool Const> class basic_iterator {
+			using table_t = std::conditional_t<Const, const digest_table, digest_table>;
+
+			table_t * table{nullptr};
+			size_t index{0u};
+
+			constexpr void skip_to_full() noexcept {
+				while (index != table->capacity() && !is_full(table->ctrl[index])) {
+					++index;
+				}
+			}
+
+			friend class digest_table;
+			template <bool> friend class basic_iterator;
+
+			constexpr basic_iterator(table_t * t, size_t i) noexcept: table{t}, index{i} { }
+
+		public:
+			using value_type = Slot;
+			using difference_type = ptrdiff_t;
+			using reference = std::conditional_t<Const, const Slot &, Slot &>;
+			using pointer = std::conditional_t<Const, const Slot *, Slot *>;
+			using iterator_category = std::forward_iterator_tag;
+
+			constexpr basic_iterator() noexcept = default;
+			template <bool OtherConst> constexpr basic_iterator(const basic_iterator<OtherConst> & other) noexcept requires(Const && !OtherConst): table{other.table}, index{other.index} { }
+
+			constexpr reference operator*() const noexcept {
+				return table->slots[index];
+			}
+
+			constexpr pointer operator->() const noexcept {
+				return table->slots + index;
+			}
+
+			constexpr basic_iterator & operator++() noexcept {
+				++index;
+				skip_to_full();
+				return *this;
+			}
+
+			constexpr basic_iterator operator++(int) noexcept {
+				auto copy = *this;
+				++(*this);
+				return copy;
+			}
+
+			constexpr friend bool operator==(const basic_iterator & lhs, const basic_iterator & rhs) noexcept {
+				return lhs.index == rhs.index;
+			}
+		};
+
+		using iterator = basic_iterator<false>;
+		using const_iterator = basic_iterator<true>;
+
+	protected:
+		uint8_t * ctrl{nullptr};
+		Slot * slots{nullptr};
+		size_t groups{0u};
+		size_t count{0u};
+		size_t growth_left{0u};
+
+		static constexpr size_t npos = static_cast<size_t>(-1);
+
+		constexpr auto iterator_at(size_t index) noexcept -> iterator {
+			return iterator{this, index};
+		}
+
+		static constexpr bool is_full(uint8_t c) noexcept {
+			return c < control_group::empty;
+		}
+
+		static constexpr size_t fingerprint_bits = sizeof(decltype(std::declval<const Value &>().fingerprint())) * 8u;
+
+		// digest is uniformly distributed, so its prefix is used directly (top bits select group, low bits of the
+		// fingerprint are used as H2, even when the fingerprint is shorter than 64 bits)
+		static constexpr auto hash_of(const Value & value) noexcept -> uint64_t {
+			return static_cast<uint64_t>(value.fingerprint()) << (64u - fingerprint_bits);
+		}
+
+		static constexpr auto h2_of(uint64_t hash) noexcept -> uint8_t {
+			return static_cast<uint8_t>((hash >> (64u - fingerprint_bits)) bitand 0b0111'1111u);
+		}
+
+		constexpr auto group_of(uint64_t hash) const noexcept -> size_t {
+			assert(groups >= min_groups);
+			return static_cast<size_t>(hash >> (64u - static_cast<unsigned>(std::countr_zero(groups))));
+		}
+
+		constexpr auto next_group(size_t g, size_t step) const noexcept -> size_t {
+			return (g + step) bitand (groups - 1u);
+		}
+
+		static constexpr auto max_load_of(size_t capacity) noexcept -> size_t {
+			return capacity - capacity / 8u;
+		}
+
+		static constexpr auto groups_for(size_t n) noexcept -> size_t {
+			const size_t slots_needed = n + n / 7u + 1u;
+			return std::max(min_groups, std::bit_ceil((slots_needed + group_width - 1u) / group_width));
+		}
+
+		constexpr void set_ctrl(size_t index, uint8_t value) noexcept {
+			ctrl[index] = value;
+		}
+
+		constexpr auto find_index(const Value & key, uint64_t hash) const noexcept -> size_t {
+			if (groups == 0u) {
+				return npos;
+			}
+
+			const uint8_t h2 = h2_of(hash);
+			size_t g = group_of(hash);
+
+			for (size_t step = 1u;; ++step) {
+				const auto group = control_group::load(ctrl + g * group_width);
+
+				for (uint64_t m = group.match(h2); m != 0u; m &= (m - 1u)) {
+					const size_t index = g * group_width + control_group::lowest(m);
+					if (KeyOf{}(slots[index]) == key) {
+						return index;
+					}
+				}
+
+				if (group.match_empty() != 0u) {
+					return npos;
+				}
+
+				assert(step <= groups);
+				g = next_group(g, step);
+			}
+		}
+
+		constexpr auto find_first_non_full(uint64_t hash) const noexcept -> size_t {
+			size_t g = group_of(hash);
+
+			for (size_t step = 1u;; ++step) {
+				const auto group = control_group::load(ctrl + g * group_width);
+
+				if (const uint64_t m = group.match_empty_or_deleted(); m != 0u) {
+					return g * group_width + control_group::lowest(m);
+				}
+
+				assert(step <= groups);
+				g = next_group(g, step);
+			}
+		}
+
+		// table is modified only after both arrays are allocated, so it stays consistent when an allocation throws
+		constexpr void allocate(size_t new_groups) {
+			const size_t new_capacity = new_groups * group_width;
+			uint8_t * const new_ctrl = std::allocator<uint8_t>{}.allocate(new_capacity);
+			Slot * new_slots = nullptr;
+
+			try {
+				new_slots = std::allocator<Slot>{}.allocate(new_capacity);
+			} catch (...) {
+				std::allocator<uint8_t>{}.deallocate(new_ctrl, new_capacity);
+				throw;
+			}
+
+			for (size_t i = 0; i != new_capacity; ++i) {
+				std::construct_at(new_ctrl + i, control_group::empty);
+			}
+
+			groups = new_groups;
+			ctrl = new_ctrl;
+			slots = new_slots;
+			growth_left = max_load_of(new_capacity);
+		}
+
+		constexpr void destroy_and_deallocate() noexcept {
+			if (groups == 0u) {
+				return;
+			}
+
+			for (size_t i = 0; i != capacity(); ++i) {
+				if (is_full(ctrl[i])) {
+					std::destroy_at(slots + i);
+				}
+			}
+
+			std::allocator<Slot>{}.deallocate(slots, capacity());
+			std::allocator<uint8_t>{}.deallocate(ctrl, capacity());
+
+			ctrl = nullptr;
+			slots = nullptr;
+			groups = 0u;
+			count = 0u;
+			growth_left = 0u;
+		}
+
+		// owns arrays of the table before rehash, slots which were not moved yet are destroyed with them (when a move throws)
+		struct old_arrays {
+			uint8_t * ctrl;
+			Slot * slots;
+			size_t capacity;
+
+			constexpr ~old_arrays() noexcept {
+				if (capacity == 0u) {
+					return;
+				}
+
+				for (size_t i = 0; i != capacity; ++i) {
+					if (is_full(ctrl[i])) {
+						std::destroy_at(slots + i);
+					}
+				}
+
+				std::allocator<Slot>{}.deallocate(slots, capacity);
+				std::allocator<uint8_t>{}.deallocate(ctrl, capacity);
+			}
+		};
+
+		constexpr void rehash(size_t new_groups) {
+			const auto old_ctrl = ctrl;
+			const auto old_slots = slots;
+			const auto old_capacity = capacity();
+
+			allocate(new_groups);
+
+			const auto old = old_arrays{old_ctrl, old_slots, old_capacity};
+			count = 0u;
+
+			for (size_t i = 0; i != old.capacity; ++i) {
+				if (!is_full(old.ctrl[i])) {
+					continue;
+				}
+
+				const uint64_t hash = hash_of(KeyOf{}(old.slots[i]));
+				const size_t target = find_first_non_full(hash);
+
+				std::construct_at(slots + target, std::move(old.slots[i]));
+				set_ctrl(target, h2_of(hash));
+				++count;
+				--growth_left;
+
+				std::destroy_at(old.slots + i);
+				old.ctrl[i] = control_group::empty;
+			}
+		}
+
+		constexpr void make_space_for_one() {
+			if (groups == 0u) {
+				allocate(min_groups);
+			} else if (growth_left == 0u) {
+				// when there are mostly tombstones, we don't need to grow
+				rehash((count * 2u <= max_load_of(capacity())) ? groups : groups * 2u);
+			}
+		}
+
+		// returns index and information if the slot was inserted, new slot is marked as full only after `construct`
+		// returns, so when it throws, the table stays unchanged
+		template <typename Construct> constexpr auto insert_with(const Value & key, Construct && construct) -> std::pair<size_t, bool> {
+			const uint64_t hash = hash_of(key);
+
+			if (const size_t existing = find_index(key, hash); existing != npos) {
+				return {existing, false};
+			}
+
+			make_space_for_one();
+
+			const size_t target = find_first_non_full(hash);
+
+			construct(slots + target);
+
+			if (ctrl[target] == control_group::empty) {
+				--growth_left;
+			}
+
+			set_ctrl(target, h2_of(hash));
+			++count;
+			return {target, true};
+		}
+
+		constexpr void erase_at(size_t index) noexcept {
+			assert(is_full(ctrl[index]));
+			std::destroy_at(slots + index);
+			--count;
+
+			// if the group still contains an empty slot, no probing sequence ever continued over it
+			const auto group = control_group::load(ctrl + (index / group_width) * group_width);
+
+			if (group.match_empty() != 0u) {
+				set_ctrl(index, control_group::empty);
+				++growth_left;
+			} else {
+				set_ctrl(index, control_group::deleted);
+			}
+		}
+
+		// insert many at once, locations for next few items are prefetched before they are inserted
+		template <typename Input, typename Construct> constexpr auto bulk_insert(std::span<Input> input, Construct && construct) -> size_t {
+			constexpr size_t window = 8u;
+
+			reserve(count + input.size());
+
+			size_t inserted = 0u;
+
+			while (!input.empty()) {
+				const auto current = input.first(std::min(window, input.size()));
+
+				for (const auto & item: current) {
+					const size_t g = group_of(hash_of(KeyOf{}(item)));
+					prefetch(ctrl + g * group_width);
+					prefetch(slots + g * group_width);
+				}
+
+				for (const auto & item: current) {
+					if (insert_with(KeyOf{}(item), [&](Slot * slot) { construct(slot, item); }).second) {
+						++inserted;
+					}
+				}
+
+				input = input.subspan(current.size());
+			}
+
+			return inserted;
+		}
+
+	public:
+		constexpr digest_table() noexcept = default;
+
+		constexpr digest_table(const digest_table & other): digest_table() {
+			if (other.groups == 0u) {
+				return;
+			}
+
+			allocate(other.groups);
+
+			// slot is marked as full after it's constructed, so the destructor releases only copied slots when a copy throws
+			for (size_t i = 0; i != capacity(); ++i) {
+				if (is_full(other.ctrl[i])) {
+					std::construct_at(slots + i, other.slots[i]);
+				}
+				ctrl[i] = other.ctrl[i];
+			}
+
+			count = other.count;
+			growth_left = other.growth_left;
+		}
+
+		constexpr digest_table(digest_table && other) noexcept: ctrl{std::exchange(other.ctrl, nullptr)}, slots{std::exchange(other.slots, nullptr)}, groups{std::exchange(other.groups, 0u)}, count{std::exchange(other.count, 0u)}, growth_left{std::exchange(other.growth_left, 0u)} { }
+
+		constexpr digest_table & operator=(const digest_table & other) {
+			if (this != &other) {
+				auto copy = other;
+				swap(copy);
+			}
+			return *this;
+		}
+
+		constexpr digest_table & operator=(digest_table && other) noexcept {
+			if (this != &other) {
+				destroy_and_deallocate();
+				swap(other);
+			}
+			return *this;
+		}
+
+		constexpr ~digest_table() noexcept {
+			destroy_and_deallocate();
+		}
+
+		constexpr void swap(digest_table & other) noexcept {
+			std::swap(ctrl, other.ctrl);
+			std::swap(slots, other.slots);
+			std::swap(groups, other.groups);
+			std::swap(count, other.count);
+			std::swap(growth_left, other.growth_left);
+		}
+
+		constexpr size_t size() const noexcept {
+			return count;
+		}
+
+		constexpr bool empty() const noexcept {
+			return count == 0u;
+		}
+
+		constexpr size_t capacity() const noexcept {
+			return groups * group_width;
+		}
+
+		constexpr void reserve(size_t n) {
+			if (const size_t needed = groups_for(n); needed > groups) {
+				rehash(needed);
+			}
+		}
+
+		constexpr void clear() noexcept {
+			destroy_and_deallocate();
+		}
+
+		constexpr bool contains(const Value & key) const noexcept {
+			return find_index(key, hash_of(key)) != npos;
+		}
+
+		constexpr iterator find(const Value & key) noexcept {
+			const size_t index = find_index(key, hash_of(key));
+			return (index != npos) ? iterator{this, index} : end();
+		}
+
+		constexpr const_iterator find(const Value & key) const noexcept {
+			const size_t index = find_index(key, hash_of(key));
+			return (index != npos) ? const_iterator{this, index} : end();
+		}
+
+		constexpr bool erase(const Value & key) noexcept {
+			const size_t index = find_index(key, hash_of(key));
+
+			if (index == npos) {
+				return false;
+			}
+
+			erase_at(index);
+			return true;
+		}
+
+		constexpr iterator begin() noexcept {
+			auto it = iterator{this, 0u};
+			if (groups != 0u) {
+				it.skip_to_full();
+			}
+			return it;
+		}
+
+		constexpr iterator end() noexcept {
+			return iterator{this, capacity()};
+		}
+
+		constexpr const_iterator begin() const noexcept {
+			auto it = const_iterator{this, 0u};
+			if (groups != 0u) {
+				it.skip_to_full();
+			}
+			return it;
+		}
+
+		constexpr const_iterator end() const noexcept {
+			return const_iterator{this, capacity()};
+		}
+	};
+
+	struct digest_set_key_of {
+		template <typename Value> constexpr const Value & operator()(const Value & v) const noexcept {
+			return v;
+		}
+	};
+
+	struct digest_map_key_of {
+		template <typename Pair> constexpr const auto & operator()(const Pair & p) const noexcept {
+			return p.first;
+		}
+	};
+
+} // namespace internal
+
+// flat set of digests (open addressing with digest's prefix used as hash)
+template <typename Value> class digest_set: public internal::digest_table<Value, Value, internal::digest_set_key_of> {
+	using super = internal::digest_table<Value, Value, internal::digest_set_key_of>;
+
+public:
+	using value_type = Value;
+	using typename super::iterator;
+	using typename super::const_iterator;
+
+	constexpr digest_set() noexcept = default;
+
+	constexpr digest_set(std::initializer_list<Value> values): digest_set() {
+		insert(std::span<const Value>(values.begin(), values.size()));
+	}
+
+	constexpr bool insert(const Value & value) {
+		return super::insert_with(value, [&](Value * slot) { std::construct_at(slot, value); }).second;
+	}
+
+	// returns number of newly inserted values
+	constexpr size_t insert(std::span<const Value> values) {
+		return super::bulk_insert(values, [](Value * slot, const Value & value) { std::construct_at(slot, value); });
+	}
+};
+
+// flat map from digests to values (same layout as digest_set)
+template <typename Value, typename T> class digest_map: public internal::digest_table<Value, std::pair<const Value, T>, internal::digest_map_key_of> {
+	using super = internal::digest_table<Value, std::pair<const Value, T>, internal::digest_map_key_of>;
+
+public:
+	using key_type = Value;
+	using mapped_type = T;
+	using value_type = std::pair<const Value, T>;
+	using typename super::iterator;
+	using typename super::const_iterator;
+
+	constexpr digest_map() noexcept = default;
+
+	template <typename... Args> constexpr auto try_emplace(const Value & key, Args &&... args) -> std::pair<iterator, bool> {
+		const auto [index, success] = super::insert_with(key, [&](value_type * slot) { std::construct_at(slot, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...)); });
+		return {super::iterator_at(index), success};
+	}
+
+	template <typename U> constexpr auto insert_or_assign(const Value & key, U && value) -> std::pair<iterator, bool> {
+		auto result = try_emplace(key, std::forward<U>(value));
+		if (!result.second) {
+			result.first->second = std::forward<U>(value);
+		}
+		return result;
+	}
+
+	constexpr T & operator[](const Value & key) {
+		return try_emplace(key).first->second;
+	}
+
+	// returns number of newly inserted pairs (existing keys are kept unchanged)
+	constexpr size_t insert(std::span<const std::pair<Value, T>> values) {
+		return super::bulk_insert(values, [](value_type * slot, const std::pair<Value, T> & value) { std::construct_at(slot, value.first, value.second); });
+	}
+};
+
+} // namespace cthash
+
+#endif
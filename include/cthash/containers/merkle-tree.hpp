@@ -0,0 +1,235 @@
+#ifndef CTHASH_CONTAINERS_MERKLE_TREE_HPP
+#define CTHASH_CONTAINERS_MERKLE_TREE_HPP
+
+#include "../hash-fixed.hpp"
+#include "../internal/parallel.hpp"
+#include "../value.hpp"
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+
+namespace cthash {
+
+// leaf = H(0x00 || data), node = H(0x01 || left || right) (RFC 6962, section 2.1)
+struct rfc6962_prefixes {
+	static constexpr std::optional<std::byte> leaf_prefix = std::byte{0x00};
+	static constexpr std::optional<std::byte> node_prefix = std::byte{0x01};
+};
+
+// leaf = H(data), node = H(left || right)
+struct no_prefixes {
+	static constexpr std::optional<std::byte> leaf_prefix = std::nullopt;
+	static constexpr std::optional<std::byte> node_prefix = std::nullopt;
+};
+
+// binary hash tree, all levels are stored one after another (leaves first, root last),
+// last node of a level with odd size is promoted to the next level unchanged (same shape as in RFC 6962)
+template <typename Hasher, typename Prefixes = rfc6962_prefixes> class merkle_tree {
+public:
+	using value_type = typename Hasher::result_t;
+
+	static constexpr size_t digest_length = value_type::digest_length;
+	static constexpr size_t node_message_length = digest_length * 2u + (Prefixes::node_prefix.has_value() ? 1u : 0u);
+	static constexpr size_t lanes = internal::default_lanes_of<Hasher>;
+
+	// levels with fewer pairs than this are not split across threads
+	static constexpr size_t parallel_threshold = 4096u;
+
+private:
+	std::vector<value_type> nodes;
+	std::vector<size_t> level_offsets;
+	size_t leaf_count = 0u;
+
+	using message_t = std::array<std::byte, node_message_length>;
+
+	static constexpr void fill_message(message_t & msg, const value_type & left, const value_type & right) noexcept {
+		auto it = msg.begin();
+		if constexpr (Prefixes::node_prefix.has_value()) {
+			*it++ = *Prefixes::node_prefix;
+		}
+		it = std::copy(left.begin(), left.end(), it);
+		std::copy(right.begin(), right.end(), it);
+	}
+
+	// hash pairs [first, last) of `in` into `out`, `lanes` nodes at once
+	static constexpr void hash_pairs(std::span<const value_type> in, std::span<value_type> out, size_t first, size_t last) noexcept {
+		size_t i = first;
+
+		if constexpr (lanes > 1u) {
+			std::array<message_t, lanes> messages;
+			const auto views = [&]<size_t... Idx>(std::index_sequence<Idx...>) {
+				return std::array{std::span<const std::byte, node_message_length>(messages[Idx])...};
+			}(std::make_index_sequence<lanes>());
+
+			for (; (last - i) >= lanes; i += lanes) {
+				for (size_t l = 0; l != lanes; ++l) {
+					fill_message(messages[l], in[2u * (i + l)], in[2u * (i + l) + 1u]);
+				}
+
+				const auto results = hash_fixed_lanes<Hasher>(views);
+				std::copy(results.begin(), results.end(), out.begin() + static_cast<std::ptrdiff_t>(i));
+			}
+		}
+
+		for (; i != last; ++i) {
+			message_t msg;
+			fill_message(msg, in[2u * i], in[2u * i + 1u]);
+			out[i] = hash_fixed<Hasher>(msg);
+		}
+	}
+
+	static constexpr void hash_level(std::span<const value_type> in, std::span<value_type> out, size_t threads) {
+		const size_t pairs = in.size() / 2u;
+
+		if consteval {
+			hash_pairs(in, out, 0u, pairs);
+		} else {
+			const size_t parts = std::min(threads, pairs / parallel_threshold);
+
+			if (parts <= 1u) {
+				hash_pairs(in, out, 0u, pairs);
+			} else {
+				internal::parallel_for_lanes(pairs, parts, lanes, [=](size_t first, size_t last) { hash_pairs(in, out, first, last); });
+			}
+		}
+
+		// odd node is promoted
+		if (in.size() % 2u) {
+			out[pairs] = in.back();
+		}
+	}
+
+	constexpr void build(size_t threads) {
+		size_t count = nodes.size();
+		leaf_count = count;
+
+		level_offsets.push_back(0u);
+
+		if (count == 0u) {
+			// root of an empty tree is hash of empty input
+			nodes.push_back(Hasher{}.final());
+			return;
+		}
+
+		// number of all nodes is less than twice number of leaves
+		nodes.reserve(2u * count);
+
+		while (count > 1u) {
+			const size_t offset = level_offsets.back();
+			const size_t next = (count + 1u) / 2u;
+
+			nodes.resize(offset + count + next);
+			level_offsets.push_back(offset + count);
+
+			hash_level(std::span<const value_type>(nodes).subspan(offset, count), std::span<value_type>(nodes).subspan(offset + count, next), threads);
+
+			count = next;
+		}
+	}
+
+public:
+	template <typename Leaf> static constexpr auto hash_leaf(const Leaf & leaf) noexcept -> value_type {
+		Hasher h{};
+		if constexpr (Prefixes::leaf_prefix.has_value()) {
+			const auto prefix = std::array<std::byte, 1>{*Prefixes::leaf_prefix};
+			h.update(std::span<const std::byte>(prefix));
+		}
+		h.update(leaf);
+		return h.final();
+	}
+
+	static constexpr auto hash_node(const value_type & left, const value_type & right) noexcept -> value_type {
+		message_t msg;
+		fill_message(msg, left, right);
+		return hash_fixed<Hasher>(msg);
+	}
+
+	// tree over leaf data (each leaf is hashed with leaf prefix)
+	template <typename Leaf> explicit constexpr merkle_tree(std::span<const Leaf> leaves, size_t threads = 1u) {
+		nodes.reserve(2u * leaves.size());
+		for (const Leaf & leaf: leaves) {
+			nodes.push_back(hash_leaf(leaf));
+		}
+		build(threads);
+	}
+
+	// tree over already hashed leaves
+	static constexpr auto from_leaf_hashes(std::vector<value_type> leaf_hashes, size_t threads = 1u) -> merkle_tree {
+		return merkle_tree{std::move(leaf_hashes), threads};
+	}
+
+	constexpr auto root() const noexcept -> const value_type & {
+		return nodes.back();
+	}
+
+	// number of leaves
+	constexpr auto size() const noexcept -> size_t {
+		return leaf_count;
+	}
+
+	constexpr auto height() const noexcept -> size_t {
+		return level_offsets.size();
+	}
+
+	constexpr auto level(size_t index) const noexcept -> std::span<const value_type> {
+		assert(index < level_offsets.size());
+		const size_t end = (index + 1u) < level_offsets.size() ? level_offsets[index + 1u] : nodes.size();
+		return std::span<const value_type>(nodes).subspan(level_offsets[index], end - level_offsets[index]);
+	}
+
+	// audit path from leaf to root (siblings only, promoted nodes have none)
+	constexpr auto proof(size_t index) const -> std::vector<value_type> {
+		assert(index < size());
+		std::vector<value_type> output;
+
+		for (size_t l = 0; (l + 1u) < level_offsets.size(); ++l, index /= 2u) {
+			const auto current = level(l);
+			const size_t sibling = index ^ 1u;
+
+			if (sibling < current.size()) {
+				output.push_back(current[sibling]);
+			}
+		}
+
+		return output;
+	}
+
+	static constexpr bool verify(const value_type & leaf_hash, size_t index, size_t tree_size, std::span<const value_type> proof, const value_type & expected_root) noexcept {
+		if (index >= tree_size) {
+			return false;
+		}
+
+		value_type current = leaf_hash;
+		auto it = proof.begin();
+
+		for (size_t count = tree_size; count > 1u; count = (count + 1u) / 2u, index /= 2u) {
+			if ((index ^ 1u) >= count) {
+				// promoted without sibling
+				continue;
+			}
+
+			if (it == proof.end()) {
+				return false;
+			}
+
+			current = (index % 2u) ? hash_node(*it, current) : hash_node(current, *it);
+			++it;
+		}
+
+		return it == proof.end() && current == expected_root;
+	}
+
+private:
+	explicit constexpr merkle_tree(std::vector<value_type> leaf_hashes, size_t threads): nodes{std::move(leaf_hashes)} {
+		build(threads);
+	}
+};
+
+} // namespace cthash
+
+#endif
@@ -0,0 +1,647 @@
+#ifndef CTHASH_CONTAINERS_MPT_ROOT_HPP
+#define CTHASH_CONTAINERS_MPT_ROOT_HPP
+
+#include "../sha3/keccak.hpp"
+#include "../sha3/keccak-fixed.hpp"
+#include "../internal/concepts.hpp"
+#include "../internal/convert.hpp"
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace cthash {
+
+namespace internal {
+
+	// recursive length prefix (RLP) encoding from Ethereum yellow paper (appendix B), headers are the same
+	// for strings (0x80) and lists (0xc0), only base differs
+	constexpr auto rlp_length_of_length(size_t length) noexcept -> size_t {
+		size_t n = 0u;
+		for (; length != 0u; length >>= 8u) {
+			++n;
+		}
+		return n;
+	}
+
+	constexpr auto rlp_header_size(size_t length) noexcept -> size_t {
+		return length <= 55u ? 1u : 1u + rlp_length_of_length(length);
+	}
+
+	constexpr void rlp_append_header(std::vector<std::byte> & out, size_t length, uint8_t base) {
+		if (length <= 55u) {
+			out.push_back(static_cast<std::byte>(base + length));
+			return;
+		}
+
+		const size_t n = rlp_length_of_length(length);
+		out.push_back(static_cast<std::byte>(base + 55u + n));
+		for (size_t i = 0; i != n; ++i) {
+			out.push_back(static_cast<std::byte>(length >> ((n - 1u - i) * 8u)));
+		}
+	}
+
+	constexpr auto rlp_string_size(std::span<const std::byte> in) noexcept -> size_t {
+		if (in.size() == 1u && in[0] < std::byte{0x80}) {
+			return 1u;
+		}
+		return rlp_header_size(in.size()) + in.size();
+	}
+
+	constexpr void rlp_append_string(std::vector<std::byte> & out, std::span<const std::byte> in) {
+		if (in.size() != 1u || in[0] >= std::byte{0x80}) {
+			rlp_append_header(out, in.size(), 0x80u);
+		}
+		out.insert(out.end(), in.begin(), in.end());
+	}
+
+} // namespace internal
+
+// root of Ethereum Merkle-Patricia trie (yellow paper, appendix D), nodes live in one vector and are linked by index,
+// modified nodes are marked dirty and `root()` re-encodes and re-hashes only them, level by level from the bottom,
+// so nodes on the same level are independent and are hashed `lanes` at once, grouped by their number of blocks
+class mpt_root {
+public:
+	using value_type = keccak_256_value;
+
+	static constexpr size_t lanes = internal::default_lanes_of<keccak_256>;
+
+	// keccak-256 of RLP of empty string
+	static constexpr value_type empty_root = value_type{"56e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421"};
+
+private:
+	static constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+	static constexpr size_t rate = keccak_256::rate;
+
+	enum class node_kind : uint8_t { leaf, extension, branch };
+
+	// range of nibbles or value bytes in one of the arenas
+	struct slice {
+		uint32_t offset{0u};
+		uint32_t length{0u};
+
+		constexpr auto drop(uint32_t n) const noexcept -> slice {
+			return {offset + n, length - n};
+		}
+
+		constexpr auto first(uint32_t n) const noexcept -> slice {
+			return {offset, n};
+		}
+	};
+
+	struct node {
+		std::array<uint32_t, 16> children; // extension uses only the first one
+		slice path{};
+		slice value{}; // empty when branch has no value
+		node_kind kind{node_kind::leaf};
+		bool dirty{true};
+		// hash of encoded node, or the encoding itself when it's shorter than a hash
+		uint8_t reference_length{0u};
+		std::array<std::byte, 32> reference;
+	};
+
+	// encoded node waiting for its hash
+	struct pending_hash {
+		uint32_t index;
+		uint32_t offset;
+		uint32_t length;
+	};
+
+	std::vector<node> nodes{};
+	std::vector<uint32_t> free_nodes{};
+	std::vector<uint8_t> nibbles{};
+	std::vector<std::byte> values{};
+	uint32_t top{none};
+	size_t count{0u};
+	value_type cached_root{empty_root};
+
+	// scratch space of `root()`, kept to reuse its allocations
+	std::vector<std::vector<uint32_t>> levels{};
+	std::vector<std::byte> encoded{};
+	std::vector<pending_hash> hashes{};
+
+	// nodes and arenas are indexed by 32 bits to keep nodes small, bigger tries are rejected
+	static constexpr auto checked_index(size_t value) -> uint32_t {
+		if (value >= none) {
+			throw std::length_error{"mpt_root supports less than 2^32 - 1 nodes, nibbles and value bytes"};
+		}
+		return static_cast<uint32_t>(value);
+	}
+
+	static constexpr auto checked_slice(size_t offset, size_t length) -> slice {
+		checked_index(offset + length);
+		return {static_cast<uint32_t>(offset), static_cast<uint32_t>(length)};
+	}
+
+	constexpr auto nibble(slice s, uint32_t i) const noexcept -> uint8_t {
+		return nibbles[s.offset + i];
+	}
+
+	constexpr auto value_of(const node & n) const noexcept -> std::span<const std::byte> {
+		return std::span<const std::byte>(values).subspan(n.value.offset, n.value.length);
+	}
+
+	constexpr auto common_prefix(slice a, slice b) const noexcept -> uint32_t {
+		const uint32_t n = std::min(a.length, b.length);
+		uint32_t i = 0u;
+		while (i != n && nibble(a, i) == nibble(b, i)) {
+			++i;
+		}
+		return i;
+	}
+
+	template <byte_like Byte> constexpr auto store_key(std::span<const Byte> key) -> slice {
+		const auto output = checked_slice(nibbles.size(), key.size() * 2u);
+		for (const Byte b: key) {
+			nibbles.push_back(static_cast<uint8_t>(static_cast<uint8_t>(b) >> 4u));
+			nibbles.push_back(static_cast<uint8_t>(static_cast<uint8_t>(b) & 0xFu));
+		}
+		return output;
+	}
+
+	template <byte_like Byte> constexpr auto store_value(std::span<const Byte> value) -> slice {
+		const auto output = checked_slice(values.size(), value.size());
+		values.resize(values.size() + value.size());
+		byte_copy(value.begin(), value.end(), values.begin() + output.offset);
+		return output;
+	}
+
+	constexpr auto concat(slice a, slice b) -> slice {
+		const auto output = checked_slice(nibbles.size(), size_t{a.length} + b.length);
+		for (uint32_t i = 0; i != a.length; ++i) {
+			nibbles.push_back(nibble(a, i));
+		}
+		for (uint32_t i = 0; i != b.length; ++i) {
+			nibbles.push_back(nibble(b, i));
+		}
+		return output;
+	}
+
+	constexpr auto new_node(node_kind kind, slice path, slice value) -> uint32_t {
+		node n{};
+		n.children.fill(none);
+		n.kind = kind;
+		n.path = path;
+		n.value = value;
+
+		if (!free_nodes.empty()) {
+			const uint32_t index = free_nodes.back();
+			free_nodes.pop_back();
+			nodes[index] = n;
+			return index;
+		}
+
+		const uint32_t index = checked_index(nodes.size());
+		nodes.push_back(n);
+		return index;
+	}
+
+	constexpr void free_node(uint32_t index) {
+		free_nodes.push_back(index);
+	}
+
+	constexpr auto with_extension(slice path, uint32_t child) -> uint32_t {
+		if (path.length == 0u) {
+			return child;
+		}
+
+		const uint32_t index = new_node(node_kind::extension, path, {});
+		nodes[index].children[0] = child;
+		return index;
+	}
+
+	// returns index of node which replaces `index` in its parent
+	constexpr auto insert_into(uint32_t index, slice key, slice value) -> uint32_t {
+		if (index == none) {
+			++count;
+			return new_node(node_kind::leaf, key, value);
+		}
+
+		nodes[index].dirty = true;
+
+		if (nodes[index].kind == node_kind::branch) {
+			if (key.length == 0u) {
+				count += (nodes[index].value.length == 0u);
+				nodes[index].value = value;
+				return index;
+			}
+
+			const uint32_t child = insert_into(nodes[index].children[nibble(key, 0u)], key.drop(1u), value);
+			nodes[index].children[nibble(key, 0u)] = child;
+			return index;
+		}
+
+		const slice path = nodes[index].path;
+		const uint32_t common = common_prefix(path, key);
+
+		if (nodes[index].kind == node_kind::leaf && common == path.length && common == key.length) {
+			nodes[index].value = value;
+			return index;
+		}
+
+		if (nodes[index].kind == node_kind::extension && common == path.length) {
+			const uint32_t child = insert_into(nodes[index].children[0], key.drop(common), value);
+			nodes[index].children[0] = child;
+			return index;
+		}
+
+		// paths diverge after `common` nibbles, existing node goes below a new branch
+		const uint32_t branch = new_node(node_kind::branch, {}, {});
+
+		if (common == path.length) {
+			// leaf ending at the branch
+			nodes[branch].value = nodes[index].value;
+			free_node(index);
+		} else if (nodes[index].kind == node_kind::extension && (path.length - common) == 1u) {
+			nodes[branch].children[nibble(path, common)] = nodes[index].children[0];
+			free_node(index);
+		} else {
+			nodes[index].path = path.drop(common + 1u);
+			nodes[branch].children[nibble(path, common)] = index;
+		}
+
+		++count;
+		if (common == key.length) {
+			nodes[branch].value = value;
+		} else {
+			nodes[branch].children[nibble(key, common)] = new_node(node_kind::leaf, key.drop(common + 1u), value);
+		}
+
+		return with_extension(key.first(common), branch);
+	}
+
+	// extension with leaf or another extension below is merged with it
+	constexpr auto normalize_extension(uint32_t index) -> uint32_t {
+		const uint32_t child = nodes[index].children[0];
+		if (nodes[child].kind == node_kind::branch) {
+			return index;
+		}
+
+		nodes[child].path = concat(nodes[index].path, nodes[child].path);
+		nodes[child].dirty = true;
+		free_node(index);
+		return child;
+	}
+
+	// branch with only one entry left becomes leaf or extension
+	constexpr auto normalize_branch(uint32_t index) -> uint32_t {
+		const auto & children = nodes[index].children;
+		const auto entries = std::ranges::count_if(children, [](uint32_t c) { return c != none; }) + (nodes[index].value.length != 0u);
+
+		if (entries > 1) {
+			return index;
+		}
+
+		if (nodes[index].value.length != 0u) {
+			nodes[index].kind = node_kind::leaf;
+			nodes[index].path = {};
+			return index;
+		}
+
+		const auto it = std::ranges::find_if(children, [](uint32_t c) { return c != none; });
+		const auto digit = static_cast<uint8_t>(it - children.begin());
+		const uint32_t child = *it;
+
+		nodes[index].kind = node_kind::extension;
+		nodes[index].path = checked_slice(nibbles.size(), 1u);
+		nibbles.push_back(digit);
+		nodes[index].children.fill(none);
+		nodes[index].children[0] = child;
+		return normalize_extension(index);
+	}
+
+	// returns index of node which replaces `index` in its parent (`none` when its subtree is empty)
+	constexpr auto erase_from(uint32_t index, slice key, bool & erased) -> uint32_t {
+		if (index == none) {
+			return none;
+		}
+
+		const node_kind kind = nodes[index].kind;
+
+		if (kind == node_kind::branch) {
+			if (key.length == 0u) {
+				if (nodes[index].value.length == 0u) {
+					return index;
+				}
+				nodes[index].value = {};
+				erased = true;
+			} else {
+				const uint32_t child = erase_from(nodes[index].children[nibble(key, 0u)], key.drop(1u), erased);
+				if (!erased) {
+					return index;
+				}
+				nodes[index].children[nibble(key, 0u)] = child;
+			}
+
+			nodes[index].dirty = true;
+			return normalize_branch(index);
+		}
+
+		const slice path = nodes[index].path;
+		const uint32_t common = common_prefix(path, key);
+
+		if (kind == node_kind::leaf) {
+			if (common != path.length || common != key.length) {
+				return index;
+			}
+			erased = true;
+			free_node(index);
+			return none;
+		}
+
+		if (common != path.length) {
+			return index;
+		}
+
+		// branch below extension never disappears, at most it shrinks to leaf or extension
+		const uint32_t child = erase_from(nodes[index].children[0], key.drop(common), erased);
+		if (!erased) {
+			return index;
+		}
+
+		nodes[index].children[0] = child;
+		nodes[index].dirty = true;
+		return normalize_extension(index);
+	}
+
+	// dirty nodes are grouped by height (a node is always above all of its dirty children)
+	constexpr auto collect_dirty(uint32_t index) -> size_t {
+		if (index == none || !nodes[index].dirty) {
+			return 0u;
+		}
+
+		size_t height = 0u;
+		if (nodes[index].kind != node_kind::leaf) {
+			for (const uint32_t child: nodes[index].children) {
+				height = std::max(height, collect_dirty(child));
+			}
+		}
+
+		if (levels.size() <= height) {
+			levels.resize(height + 1u);
+		}
+		levels[height].push_back(index);
+		return height + 1u;
+	}
+
+	// hex-prefix encoding of the path (appendix C), flag is in the first nibble
+	constexpr auto hex_prefix_size(slice path) const noexcept -> size_t {
+		const size_t length = path.length / 2u + 1u;
+		return length == 1u ? 1u : internal::rlp_header_size(length) + length;
+	}
+
+	constexpr void append_hex_prefix(slice path, bool leaf) {
+		const size_t length = path.length / 2u + 1u;
+		if (length != 1u) {
+			internal::rlp_append_header(encoded, length, 0x80u);
+		}
+
+		const auto flag = static_cast<uint8_t>((leaf ? 2u : 0u) + (path.length % 2u));
+		uint32_t i = 0u;
+
+		if (path.length % 2u) {
+			encoded.push_back(static_cast<std::byte>((flag << 4u) | nibble(path, i++)));
+		} else {
+			encoded.push_back(static_cast<std::byte>(flag << 4u));
+		}
+
+		for (; i != path.length; i += 2u) {
+			encoded.push_back(static_cast<std::byte>((nibble(path, i) << 4u) | nibble(path, i + 1u)));
+		}
+	}
+
+	constexpr auto reference_size(uint32_t child) const noexcept -> size_t {
+		if (child == none) {
+			return 1u;
+		}
+		const size_t length = nodes[child].reference_length;
+		return length == 32u ? 33u : length;
+	}
+
+	constexpr void append_reference(uint32_t child) {
+		if (child == none) {
+			encoded.push_back(std::byte{0x80});
+			return;
+		}
+
+		const node & n = nodes[child];
+		if (n.reference_length == 32u) {
+			encoded.push_back(std::byte{0x80 + 32});
+		}
+		encoded.insert(encoded.end(), n.reference.begin(), n.reference.begin() + n.reference_length);
+	}
+
+	constexpr void encode(uint32_t index) {
+		const node & n = nodes[index];
+		size_t payload = 0u;
+
+		switch (n.kind) {
+		case node_kind::leaf:
+			payload = hex_prefix_size(n.path) + internal::rlp_string_size(value_of(n));
+			break;
+		case node_kind::extension:
+			payload = hex_prefix_size(n.path) + reference_size(n.children[0]);
+			break;
+		case node_kind::branch:
+			for (const uint32_t child: n.children) {
+				payload += reference_size(child);
+			}
+			payload += internal::rlp_string_size(value_of(n));
+			break;
+		}
+
+		internal::rlp_append_header(encoded, payload, 0xC0u);
+
+		if (n.kind == node_kind::branch) {
+			for (const uint32_t child: n.children) {
+				append_reference(child);
+			}
+		} else {
+			append_hex_prefix(n.path, n.kind == node_kind::leaf);
+			if (n.kind == node_kind::extension) {
+				append_reference(n.children[0]);
+				return;
+			}
+		}
+
+		internal::rlp_append_string(encoded, value_of(n));
+	}
+
+	constexpr void set_hash(const pending_hash & item, const value_type & hash) noexcept {
+		node & n = nodes[item.index];
+		std::copy(hash.begin(), hash.end(), n.reference.begin());
+		n.reference_length = 32u;
+	}
+
+	constexpr void hash_level(std::span<const uint32_t> level) {
+		encoded.clear();
+		hashes.clear();
+
+		for (const uint32_t index: level) {
+			const size_t offset = encoded.size();
+			encode(index);
+			const size_t length = encoded.size() - offset;
+
+			if (length < 32u) {
+				// short nodes are embedded into their parent
+				node & n = nodes[index];
+				std::copy(encoded.begin() + static_cast<std::ptrdiff_t>(offset), encoded.end(), n.reference.begin());
+				n.reference_length = static_cast<uint8_t>(length);
+			} else {
+				const slice range = checked_slice(offset, length);
+				hashes.push_back({index, range.offset, range.length});
+			}
+
+			nodes[index].dirty = false;
+		}
+
+		// nodes with same number of blocks need the same number of permutations
+		std::ranges::sort(hashes, {}, [](const pending_hash & item) { return item.length / rate; });
+
+		const auto input = [&](const pending_hash & item) {
+			return std::span<const std::byte>(encoded).subspan(item.offset, item.length);
+		};
+
+		size_t i = 0u;
+		while (i != hashes.size()) {
+			if constexpr (lanes > 1u) {
+				if ((hashes.size() - i) >= lanes && (hashes[i].length / rate) == (hashes[i + lanes - 1u].length / rate)) {
+					const auto inputs = [&]<size_t... Idx>(std::index_sequence<Idx...>) {
+						return std::array{input(hashes[i + Idx])...};
+					}(std::make_index_sequence<lanes>());
+
+					const auto results = keccak_256_lanes(inputs);
+					for (size_t l = 0; l != lanes; ++l) {
+						set_hash(hashes[i + l], results[l]);
+					}
+					i += lanes;
+					continue;
+				}
+			}
+
+			set_hash(hashes[i], keccak_256{}.update(input(hashes[i])).final());
+			++i;
+		}
+	}
+
+public:
+	constexpr mpt_root() noexcept = default;
+
+	// empty value removes the key (same as in Ethereum state)
+	template <convertible_to_byte_span Key, convertible_to_byte_span Value> constexpr mpt_root & insert(const Key & key, const Value & value) {
+		using key_byte = typename decltype(std::span(key))::value_type;
+		using value_byte = typename decltype(std::span(value))::value_type;
+
+		const auto v = std::span<const value_byte>(value);
+		if (v.empty()) {
+			erase(key);
+			return *this;
+		}
+
+		const slice k = store_key(std::span<const key_byte>(key));
+		top = insert_into(top, k, store_value(v));
+		return *this;
+	}
+
+	template <convertible_to_byte_span Key> constexpr bool erase(const Key & key) {
+		using key_byte = typename decltype(std::span(key))::value_type;
+
+		// key is stored only temporarily
+		const size_t mark = nibbles.size();
+		const slice k = store_key(std::span<const key_byte>(key));
+
+		bool erased = false;
+		const uint32_t replacement = erase_from(top, k, erased);
+
+		if (!erased) {
+			nibbles.resize(mark);
+			return false;
+		}
+
+		top = replacement;
+		--count;
+		return true;
+	}
+
+	// rehashes only nodes modified since last call
+	constexpr auto root() -> value_type {
+		if (top == none) {
+			return empty_root;
+		}
+
+		if (!nodes[top].dirty) {
+			return cached_root;
+		}
+
+		for (auto & level: levels) {
+			level.clear();
+		}
+		collect_dirty(top);
+
+		for (const auto & level: levels) {
+			hash_level(level);
+		}
+
+		// root is always hashed, even when it's shorter than a hash
+		const node & n = nodes[top];
+		if (n.reference_length == 32u) {
+			std::copy(n.reference.begin(), n.reference.end(), cached_root.begin());
+		} else {
+			cached_root = keccak_256{}.update(std::span<const std::byte>(n.reference).first(n.reference_length)).final();
+		}
+
+		return cached_root;
+	}
+
+	// replaced values and paths of merged nodes stay in arenas, this keeps only those which are still used
+	constexpr void compact() {
+		std::vector<uint8_t> live_nibbles{};
+		std::vector<std::byte> live_values{};
+		std::vector<uint32_t> stack{};
+
+		if (top != none) {
+			stack.push_back(top);
+		}
+
+		while (!stack.empty()) {
+			node & n = nodes[stack.back()];
+			stack.pop_back();
+
+			const auto path = std::span<const uint8_t>(nibbles).subspan(n.path.offset, n.path.length);
+			n.path.offset = checked_index(live_nibbles.size());
+			live_nibbles.insert(live_nibbles.end(), path.begin(), path.end());
+
+			const auto value = value_of(n);
+			n.value.offset = checked_index(live_values.size());
+			live_values.insert(live_values.end(), value.begin(), value.end());
+
+			for (const uint32_t child: n.children) {
+				if (child != none) {
+					stack.push_back(child);
+				}
+			}
+		}
+
+		nibbles = std::move(live_nibbles);
+		values = std::move(live_values);
+	}
+
+	// number of keys
+	constexpr auto size() const noexcept -> size_t {
+		return count;
+	}
+
+	constexpr bool empty() const noexcept {
+		return count == 0u;
+	}
+};
+
+} // namespace cthash
+
+#endif
@@ -0,0 +1,204 @@
+#ifndef CTHASH_CONTAINERS_PERFECT_HASH_HPP
+#define CTHASH_CONTAINERS_PERFECT_HASH_HPP
+
+#include "../fixed-string.hpp"
+#include "../xxhash.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <vector>
+#include <cstdint>
+
+namespace cthash {
+
+namespace internal {
+
+	// displacement is mixed with whole hash, so keys from one bucket move independently
+	constexpr auto perfect_hash_position(uint64_t hash, uint32_t displacement, unsigned shift) noexcept -> size_t {
+		return static_cast<size_t>(((hash ^ displacement) * 0x9E37'79B9'7F4A'7C15ull) >> shift);
+	}
+
+} // namespace internal
+
+// perfect hash table over fixed set of string keys (CHD style hash and displace), keys are hashed by seeded xxhash64,
+// lower bits of the hash select a bucket and bucket's displacement moves its keys to free slots, seed and all
+// displacements are searched in constructor (usually during compilation)
+template <size_t N> class perfect_hash_table {
+public:
+	// returned for unknown keys, otherwise index of key in constructor's input is returned
+	static constexpr size_t npos = N;
+
+	static constexpr size_t slot_count = std::bit_ceil(std::max<size_t>(N + N / 4u, 2u));
+	static constexpr size_t bucket_count = std::bit_ceil(std::max<size_t>(N / 4u, 1u));
+	static constexpr uint32_t max_displacement = 1u << 16u;
+	// with such load factor and displacement limit almost every seed works, this only guarantees termination
+	static constexpr uint64_t max_seeds = 64u;
+
+	struct slot {
+		std::string_view key;
+		size_t index;
+	};
+
+private:
+	static constexpr unsigned shift = 64u - static_cast<unsigned>(std::countr_zero(slot_count));
+
+	uint64_t hash_seed{0u};
+	std::array<uint32_t, bucket_count> displacements{};
+	// unused slots contain a key which is stored in another slot, so lookup doesn't need to check for them
+	std::array<slot, slot_count> slots{};
+
+	static constexpr auto hash_of(std::string_view key, uint64_t seed) noexcept -> uint64_t {
+		return xxhash<64>{seed}.update_and_final_value(key);
+	}
+
+	static constexpr auto bucket_of(uint64_t hash) noexcept -> size_t {
+		return static_cast<size_t>(hash) & (bucket_count - 1u);
+	}
+
+	static constexpr bool unique(std::span<const std::string_view, N> keys) {
+		std::vector<std::string_view> sorted(keys.begin(), keys.end());
+		std::sort(sorted.begin(), sorted.end());
+		return std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end();
+	}
+
+	constexpr bool try_seed(std::span<const std::string_view, N> keys, uint64_t seed) {
+		std::vector<uint64_t> hashes(N);
+		std::vector<size_t> bucket_sizes(bucket_count);
+
+		for (size_t i = 0; i != N; ++i) {
+			hashes[i] = hash_of(keys[i], seed);
+			++bucket_sizes[bucket_of(hashes[i])];
+		}
+
+		// biggest buckets are placed first while the table is still empty
+		std::vector<size_t> order(N);
+		std::iota(order.begin(), order.end(), size_t{0u});
+		std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+			const size_t lb = bucket_of(hashes[lhs]);
+			const size_t rb = bucket_of(hashes[rhs]);
+			return std::tuple(bucket_sizes[rb], lb) < std::tuple(bucket_sizes[lb], rb);
+		});
+
+		std::vector<uint8_t> used(slot_count);
+		std::vector<size_t> positions{};
+
+		for (size_t first = 0; first != N;) {
+			const size_t bucket = bucket_of(hashes[order[first]]);
+			const size_t last = first + bucket_sizes[bucket];
+
+			const auto fits = [&](uint32_t d) {
+				positions.clear();
+				for (size_t i = first; i != last; ++i) {
+					const size_t pos = internal::perfect_hash_position(hashes[order[i]], d, shift);
+					if (used[pos] || std::find(positions.begin(), positions.end(), pos) != positions.end()) {
+						return false;
+					}
+					positions.push_back(pos);
+				}
+				return true;
+			};
+
+			uint32_t d = 0u;
+			while (d != max_displacement && !fits(d)) {
+				++d;
+			}
+
+			if (d == max_displacement) {
+				return false;
+			}
+
+			displacements[bucket] = d;
+
+			for (size_t i = first; i != last; ++i) {
+				used[positions[i - first]] = 1u;
+				slots[positions[i - first]] = slot{keys[order[i]], order[i]};
+			}
+
+			first = last;
+		}
+
+		for (size_t pos = 0; pos != slot_count; ++pos) {
+			if (!used[pos]) {
+				slots[pos] = slot{(N != 0u) ? keys[0] : std::string_view{}, npos};
+			}
+		}
+
+		return true;
+	}
+
+public:
+	// keys must be unique, their views must outlive the table, throws otherwise (so it doesn't compile in constant evaluation)
+	explicit constexpr perfect_hash_table(std::span<const std::string_view, N> keys) {
+		if (!unique(keys)) {
+			throw std::invalid_argument{"keys of perfect_hash_table must be unique"};
+		}
+
+		while (!try_seed(keys, hash_seed)) {
+			if (++hash_seed == max_seeds) {
+				throw std::runtime_error{"perfect_hash_table didn't find a seed for the keys"};
+			}
+		}
+	}
+
+	constexpr auto size() const noexcept -> size_t {
+		return N;
+	}
+
+	constexpr auto seed() const noexcept -> uint64_t {
+		return hash_seed;
+	}
+
+	// one hash, one load of displacement and one load and compare of a slot
+	constexpr auto find(std::string_view key) const noexcept -> size_t {
+		const uint64_t hash = hash_of(key, hash_seed);
+		const slot & candidate = slots[internal::perfect_hash_position(hash, displacements[bucket_of(hash)], shift)];
+		return (candidate.key == key) ? candidate.index : npos;
+	}
+
+	constexpr bool contains(std::string_view key) const noexcept {
+		return find(key) != npos;
+	}
+};
+
+template <size_t N> perfect_hash_table(const std::array<std::string_view, N> &) -> perfect_hash_table<N>;
+
+// compile time set of strings, each key is mapped to its position in the list, eg. for switch over strings:
+//
+//   using keywords = cthash::static_map<"if", "else", "while">;
+//   switch (keywords::find(token)) {
+//     case keywords::index_of<"while">(): ...
+//     case keywords::npos: ...
+//   }
+template <fixed_string... Keys> struct static_map {
+	static constexpr size_t npos = sizeof...(Keys);
+
+	static constexpr auto keys = std::array<std::string_view, sizeof...(Keys)>{std::string_view(Keys.data(), Keys.size())...};
+	static constexpr auto table = perfect_hash_table<sizeof...(Keys)>{keys};
+
+	static constexpr auto size() noexcept -> size_t {
+		return sizeof...(Keys);
+	}
+
+	static constexpr auto find(std::string_view key) noexcept -> size_t {
+		return table.find(key);
+	}
+
+	static constexpr bool contains(std::string_view key) noexcept {
+		return table.contains(key);
+	}
+
+	template <fixed_string Key> static consteval auto index_of() noexcept -> size_t {
+		constexpr size_t result = find(std::string_view(Key.data(), Key.size()));
+		static_assert(result != npos, "key is not part of static_map");
+		return result;
+	}
+};
+
+} // namespace cthash
+
+#endif
@@ -0,0 +1,224 @@
+#ifndef CTHASH_CONTAINERS_SORTED_DIGESTS_HPP
+#define CTHASH_CONTAINERS_SORTED_DIGESTS_HPP
+
+#include "../value.hpp"
+#include "../internal/prefetch.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <span>
+#include <utility>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+
+namespace cthash {
+
+namespace internal {
+
+	template <typename Value> constexpr auto byte_at(const Value & value, size_t index) noexcept -> uint8_t {
+		return static_cast<uint8_t>(value[index]);
+	}
+
+	// in-place MSD radix sort (american flag sort), bytes of digest are uniformly distributed so buckets are balanced
+	template <typename Value> constexpr void american_flag_sort(std::span<Value> values, size_t byte_index) {
+		constexpr size_t small_enough = 32u;
+
+		if (values.size() <= small_enough || byte_index == Value{}.size()) {
+			std::sort(values.begin(), values.end());
+			return;
+		}
+
+		std::array<size_t, 256> ends{};
+
+		for (const Value & v: values) {
+			++ends[byte_at(v, byte_index)];
+		}
+
+		std::array<size_t, 256> heads{};
+		size_t sum = 0u;
+
+		for (size_t b = 0; b != heads.size(); ++b) {
+			heads[b] = sum;
+			sum += ends[b];
+			ends[b] = sum;
+		}
+
+		const auto begins = heads;
+
+		// move each value into its bucket
+		for (size_t b = 0; b != heads.size(); ++b) {
+			while (heads[b] != ends[b]) {
+				const uint8_t target = byte_at(values[heads[b]], byte_index);
+
+				if (target == b) {
+					++heads[b];
+				} else {
+					std::swap(values[heads[b]], values[heads[target]++]);
+				}
+			}
+		}
+
+		for (size_t b = 0; b != begins.size(); ++b) {
+			if ((ends[b] - begins[b]) > 1u) {
+				american_flag_sort(values.subspan(begins[b], ends[b] - begins[b]), byte_index + 1u);
+			}
+		}
+	}
+
+	template <typename Value> constexpr auto fingerprint_of(const Value & value) noexcept -> uint64_t {
+		constexpr size_t fingerprint_bits = sizeof(decltype(value.fingerprint())) * 8u;
+		return static_cast<uint64_t>(value.fingerprint()) << (64u - fingerprint_bits);
+	}
+
+} // namespace internal
+
+// sort digests by their byte order (same as operator<=>)
+template <typename Value, size_t Extent> constexpr void radix_sort(std::span<Value, Extent> values) {
+	internal::american_flag_sort(std::span<Value>(values), 0u);
+}
+
+// lower_bound over sorted digests, position is interpolated from digest's prefix (they are uniformly distributed)
+template <typename Value> constexpr auto interpolation_lower_bound(std::span<const Value> sorted, const Value & key) noexcept -> size_t {
+	constexpr size_t small_enough = 16u;
+	constexpr int max_interpolation_steps = 6;
+
+	// invariant: everything before `low` is smaller than key, everything from `high` is not smaller
+	size_t low = 0u;
+	size_t high = sorted.size();
+
+	uint64_t low_fingerprint = 0u;
+	uint64_t high_fingerprint = ~uint64_t{0u};
+
+	const uint64_t key_fingerprint = internal::fingerprint_of(key);
+
+	for (int step = 0; step != max_interpolation_steps && (high - low) > small_enough; ++step) {
+		if (key_fingerprint < low_fingerprint || key_fingerprint > high_fingerprint || low_fingerprint == high_fingerprint) {
+			break;
+		}
+
+		const double ratio = static_cast<double>(key_fingerprint - low_fingerprint) / static_cast<double>(high_fingerprint - low_fingerprint);
+		const size_t pos = std::min(low + static_cast<size_t>(ratio * static_cast<double>(high - low)), high - 1u);
+
+		if (sorted[pos] < key) {
+			low = pos + 1u;
+			low_fingerprint = internal::fingerprint_of(sorted[pos]);
+		} else {
+			high = pos;
+			high_fingerprint = internal::fingerprint_of(sorted[pos]);
+		}
+	}
+
+	return static_cast<size_t>(std::lower_bound(sorted.begin() + static_cast<ptrdiff_t>(low), sorted.begin() + static_cast<ptrdiff_t>(high), key) - sorted.begin());
+}
+
+// column of sorted digests
+template <typename Value> class sorted_digests {
+	std::vector<Value> values;
+
+public:
+	using value_type = Value;
+
+	constexpr sorted_digests() noexcept = default;
+
+	explicit constexpr sorted_digests(std::vector<Value> input): values{std::move(input)} {
+		radix_sort(std::span<Value>(values));
+	}
+
+	constexpr auto size() const noexcept -> size_t {
+		return values.size();
+	}
+
+	constexpr bool empty() const noexcept {
+		return values.empty();
+	}
+
+	constexpr auto span() const noexcept -> std::span<const Value> {
+		return values;
+	}
+
+	constexpr auto begin() const noexcept {
+		return values.begin();
+	}
+
+	constexpr auto end() const noexcept {
+		return values.end();
+	}
+
+	constexpr const Value & operator[](size_t index) const noexcept {
+		return values[index];
+	}
+
+	constexpr auto lower_bound(const Value & key) const noexcept -> size_t {
+		return interpolation_lower_bound(span(), key);
+	}
+
+	constexpr bool contains(const Value & key) const noexcept {
+		const size_t index = lower_bound(key);
+		return index != values.size() && values[index] == key;
+	}
+};
+
+// digests stored in BFS order of implicit binary search tree, search is branchless and prefetches next levels
+template <typename Value> class eytzinger_index {
+	// 1-based, first item is unused
+	std::vector<Value> nodes;
+
+	constexpr size_t build(std::span<const Value> sorted, size_t i, size_t k) {
+		if (k < nodes.size()) {
+			i = build(sorted, i, 2u * k);
+			nodes[k] = sorted[i++];
+			i = build(sorted, i, 2u * k + 1u);
+		}
+		return i;
+	}
+
+public:
+	using value_type = Value;
+
+	constexpr eytzinger_index(): nodes(1u) { }
+
+	explicit constexpr eytzinger_index(std::span<const Value> sorted): nodes(sorted.size() + 1u) {
+		assert(std::is_sorted(sorted.begin(), sorted.end()));
+		[[maybe_unused]] const size_t used = build(sorted, 0u, 1u);
+		assert(used == sorted.size());
+	}
+
+	constexpr auto size() const noexcept -> size_t {
+		return nodes.size() - 1u;
+	}
+
+	// returns first value not smaller than key (or nullptr)
+	constexpr auto lower_bound(const Value & key) const noexcept -> const Value * {
+		const size_t n = size();
+		size_t k = 1u;
+
+		while (k <= n) {
+			// grandchildren are next to each other
+			if !consteval {
+				if (4u * k <= n) {
+					const auto bytes = reinterpret_cast<const char *>(nodes.data() + 4u * k);
+					for (size_t offset = 0; offset < 4u * sizeof(Value); offset += 64u) {
+						internal::prefetch(bytes + offset);
+					}
+				}
+			}
+
+			k = 2u * k + static_cast<size_t>(nodes[k] < key);
+		}
+
+		// remove right turns made after last left turn
+		k >>= static_cast<unsigned>(std::countr_one(k)) + 1u;
+
+		return (k != 0u) ? (nodes.data() + k) : nullptr;
+	}
+
+	constexpr bool contains(const Value & key) const noexcept {
+		const Value * result = lower_bound(key);
+		return result != nullptr && *result == key;
+	}
+};
+
+} // namespace cthash
+
+#endif
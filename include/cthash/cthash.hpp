@@ -4,6 +4,7 @@
 // SHA-2 family
 #include "sha2/sha224.hpp"
 #include "sha2/sha256.hpp"
+#include "sha2/sha256d.hpp"
 #include "sha2/sha384.hpp"
 #include "sha2/sha512.hpp"
 #include "sha2/sha512/t.hpp"
@@ -13,6 +14,14 @@
 #include "sha3/sha3.hpp"
 #include "sha3/shake128.hpp"
 #include "sha3/shake256.hpp"
+#include "sha3/shake-drbg.hpp"
+#include "sha3/turboshake.hpp"
+
+// NIST SP 800-185 (cSHAKE, KMAC, TupleHash, ParallelHash)
+#include "sha3/cshake.hpp"
+#include "sha3/kmac.hpp"
+#include "sha3/parallelhash.hpp"
+#include "sha3/tuplehash.hpp"
 
 // xxhash (non-crypto fast hash)
 #include "xxhash.hpp"
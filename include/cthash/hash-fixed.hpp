@@ -0,0 +1,315 @@
+#ifndef CTHASH_HASH_FIXED_HPP
+#define CTHASH_HASH_FIXED_HPP
+
+#include "hasher.hpp"
+#include "value.hpp"
+#include "sha2/lanes.hpp"
+#include "sha3/common.hpp"
+#include <algorithm>
+#include <array>
+#include <span>
+#include <utility>
+#include <cassert>
+#include <cstddef>
+
+namespace cthash {
+
+namespace internal {
+
+	template <typename Hasher, size_t N> struct fixed_size_hashing;
+
+	// length of message is known, so padding (and length) is put into the last block(s) during compilation,
+	// message schedule of a block made only of padding is computed during compilation and for the tail block
+	// everything what doesn't depend on the message too
+	template <typename Config, size_t N> struct fixed_size_hashing<hasher<Config>, N> {
+		using hasher_t = internal_hasher<Config>;
+		using block_value_t = typename hasher_t::block_value_t;
+		using staging_value_t = typename hasher_t::staging_value_t;
+		using result_t = typename hasher_t::result_t;
+
+		static constexpr size_t block_size = hasher_t::block_size_bytes;
+		static constexpr size_t full_blocks = N / block_size;
+		static constexpr size_t tail = N % block_size;
+		static constexpr bool separate_length_block = (tail + 1u + Config::length_size_bits / 8u) > block_size;
+
+		static constexpr block_value_t tail_block = [] {
+			block_value_t output{};
+			const bool needs_another_block = hasher_t::finalize_buffer(output, tail);
+			if (!needs_another_block) {
+				hasher_t::finalize_buffer_by_writing_length(output, N);
+			}
+			return output;
+		}();
+
+		static constexpr block_value_t length_block = [] {
+			block_value_t output{};
+			hasher_t::finalize_buffer_by_writing_length(output, N);
+			return output;
+		}();
+
+		static constexpr staging_value_t tail_staging = hasher_t::build_staging(tail_block);
+		static constexpr staging_value_t length_staging = hasher_t::build_staging(length_block);
+
+		using staging_item_t = typename staging_value_t::value_type;
+		static constexpr size_t word_size = sizeof(staging_item_t);
+		static constexpr size_t message_words = (tail + word_size - 1u) / word_size;
+
+		// words of the tail block's schedule which don't depend on the message (padding, length and words
+		// expanded only from them)
+		static constexpr std::array<bool, std::tuple_size_v<staging_value_t>> constant_words = [] {
+			std::array<bool, std::tuple_size_v<staging_value_t>> output{};
+			for (size_t i = 0; i != 16u; ++i) {
+				output[i] = (i >= message_words);
+			}
+			for (size_t i = 16u; i != output.size(); ++i) {
+				output[i] = output[i - 16u] && output[i - 15u] && output[i - 7u] && output[i - 2u];
+			}
+			return output;
+		}();
+
+		// constant words are complete, other expanded words contain sum of their constant terms
+		static constexpr staging_value_t tail_schedule_constants = [] {
+			staging_value_t output = tail_staging;
+			for (size_t i = 16u; i != output.size(); ++i) {
+				if (constant_words[i]) {
+					continue;
+				}
+				staging_item_t sum = 0u;
+				if (constant_words[i - 16u]) sum += tail_staging[i - 16u];
+				if (constant_words[i - 15u]) sum += Config::sigma_0(tail_staging[i - 15u]);
+				if (constant_words[i - 7u]) sum += tail_staging[i - 7u];
+				if (constant_words[i - 2u]) sum += Config::sigma_1(tail_staging[i - 2u]);
+				output[i] = sum;
+			}
+			return output;
+		}();
+
+		template <size_t I> [[gnu::always_inline]] static constexpr void expand_tail_word(staging_value_t & w) noexcept {
+			if constexpr (!constant_words[I]) {
+				staging_item_t v = w[I];
+				if constexpr (!constant_words[I - 16u]) v += w[I - 16u];
+				if constexpr (!constant_words[I - 15u]) v += Config::sigma_0(w[I - 15u]);
+				if constexpr (!constant_words[I - 7u]) v += w[I - 7u];
+				if constexpr (!constant_words[I - 2u]) v += Config::sigma_1(w[I - 2u]);
+				w[I] = v;
+			}
+		}
+
+		// only terms which depend on the message are calculated (eg. for 32 byte input, words 8-15 are constant)
+		static constexpr auto tail_schedule(const block_value_t & block) noexcept -> staging_value_t {
+			staging_value_t w = tail_schedule_constants;
+			for (size_t i = 0; i != message_words; ++i) {
+				w[i] = cast_from_bytes<staging_item_t>(std::span<const std::byte, block_size>(block).subspan(i * word_size).template first<word_size>());
+			}
+			[&]<size_t... Idx>(std::index_sequence<Idx...>) {
+				(expand_tail_word<16u + Idx>(w), ...);
+			}(std::make_index_sequence<w.size() - 16u>());
+			return w;
+		}
+
+		template <byte_like Byte> static constexpr auto calculate(std::span<const Byte, N> in) noexcept -> result_t {
+			hasher_t h{};
+
+			for (size_t i = 0; i != full_blocks; ++i) {
+				const staging_value_t w = hasher_t::template build_staging<Byte>(in.subspan(i * block_size).template first<block_size>());
+				hasher_t::rounds(w, h.hash);
+			}
+
+			if constexpr (tail == 0u) {
+				hasher_t::rounds(tail_staging, h.hash);
+			} else {
+				block_value_t block = tail_block;
+				byte_copy(in.begin() + static_cast<std::ptrdiff_t>(full_blocks * block_size), in.end(), block.begin());
+
+				const staging_value_t w = tail_schedule(block);
+				hasher_t::rounds(w, h.hash);
+
+				if constexpr (separate_length_block) {
+					hasher_t::rounds(length_staging, h.hash);
+				}
+			}
+
+			result_t output;
+			h.write_result_into(output);
+			return output;
+		}
+
+		// same as above but over multiple inputs in parallel lanes
+		template <size_t Lanes, byte_like Byte> static constexpr auto calculate_lanes(const std::array<std::span<const Byte, N>, Lanes> & in) noexcept -> std::array<result_t, Lanes> {
+			using lanes_t = sha2::lanes<Config, Lanes>;
+			typename lanes_t::state_t state = lanes_t::initial_state();
+			typename lanes_t::block_t w;
+
+			for (size_t i = 0; i != full_blocks; ++i) {
+				for (size_t l = 0; l != Lanes; ++l) {
+					lanes_t::template load_block<Byte>(w, l, in[l].subspan(i * block_size).template first<block_size>());
+				}
+				lanes_t::compress(w, state);
+			}
+
+			if constexpr (tail == 0u) {
+				lanes_t::compress(lanes_t::broadcast(tail_block), state);
+			} else {
+				for (size_t l = 0; l != Lanes; ++l) {
+					block_value_t block = tail_block;
+					byte_copy(in[l].begin() + static_cast<std::ptrdiff_t>(full_blocks * block_size), in[l].end(), block.begin());
+					lanes_t::load_block(w, l, std::span<const std::byte, block_size>(block));
+				}
+				lanes_t::compress(w, state);
+
+				if constexpr (separate_length_block) {
+					lanes_t::compress(lanes_t::broadcast(length_block), state);
+				}
+			}
+
+			std::array<result_t, Lanes> output;
+			for (size_t l = 0; l != Lanes; ++l) {
+				lanes_t::store_digest(state, l, output[l]);
+			}
+			return output;
+		}
+	};
+
+	// padding of the last block is a constant state which is xored with state after absorbing the tail
+	template <typename Config, size_t N> struct fixed_size_hashing<keccak_hasher<Config>, N> {
+		using hasher_t = basic_keccak_hasher<Config>;
+		using result_t = typename hasher_t::result_t;
+		using value_t = keccak::state_1600::value_type;
+
+		static_assert(hasher_t::digest_length != 0u, "Only fixed size digests are supported!");
+
+		static constexpr size_t rate = hasher_t::rate;
+		static constexpr size_t full_blocks = N / rate;
+		static constexpr size_t tail = N % rate;
+
+		static constexpr keccak::state_1600 padding = [] {
+			hasher_t h{};
+			h.position = static_cast<uint8_t>(tail);
+			h.xor_padding_block();
+			return h.internal_state;
+		}();
+
+		// xor of the tail (without any position tracking if it's made of whole lanes) and of non-zero lanes of padding
+		template <byte_like Byte> [[gnu::always_inline]] static constexpr void absorb_tail(keccak::state_1600 & state, std::span<const Byte, tail> in) noexcept {
+			if constexpr ((tail % sizeof(value_t)) == 0u) {
+				[&]<size_t... Idx>(std::index_sequence<Idx...>) {
+					((state[Idx] ^= cast_from_le_bytes<value_t>(in.template subspan<Idx * sizeof(value_t), sizeof(value_t)>())), ...);
+				}(std::make_index_sequence<tail / sizeof(value_t)>());
+			} else {
+				hasher_t h{};
+				h.internal_state = state;
+				h.template xor_overwrite_block<Byte>(in);
+				state = h.internal_state;
+			}
+
+			[&]<size_t... Idx>(std::index_sequence<Idx...>) {
+				(([&] {
+					if constexpr (padding[Idx] != 0u) {
+						state[Idx] ^= padding[Idx];
+					}
+				}()),
+					...);
+			}(std::make_index_sequence<padding.size()>());
+		}
+
+		template <byte_like Byte> static constexpr auto calculate(std::span<const Byte, N> in) noexcept -> result_t {
+			hasher_t h{};
+
+			for (size_t i = 0; i != full_blocks; ++i) {
+				h.template absorb_block<Byte>(in.subspan(i * rate).template first<rate>());
+				h.permute();
+			}
+
+			absorb_tail<Byte>(h.internal_state, in.template last<tail>());
+			h.permute();
+
+			result_t output;
+			h.squeeze(typename hasher_t::digest_span_t(output));
+			return output;
+		}
+
+		// same as above but over multiple inputs with multi-state permutation
+		template <size_t Lanes, byte_like Byte> static constexpr auto calculate_lanes(const std::array<std::span<const Byte, N>, Lanes> & in) noexcept -> std::array<result_t, Lanes> {
+			keccak::state_1600_lanes<Lanes> states{};
+
+			for (size_t i = 0; i != full_blocks; ++i) {
+				for (size_t l = 0; l != Lanes; ++l) {
+					for (size_t w = 0; w != rate / sizeof(value_t); ++w) {
+						states[w][l] ^= cast_from_le_bytes<value_t>(in[l].subspan(i * rate + w * sizeof(value_t)).template first<sizeof(value_t)>());
+					}
+				}
+				keccak::keccak_p<hasher_t::rounds>(states);
+			}
+
+			for (size_t l = 0; l != Lanes; ++l) {
+				keccak::state_1600 state{};
+				absorb_tail<Byte>(state, in[l].template last<tail>());
+				for (size_t w = 0; w != state.size(); ++w) {
+					states[w][l] ^= state[w];
+				}
+			}
+			keccak::keccak_p<hasher_t::rounds>(states);
+
+			std::array<result_t, Lanes> output;
+			for (size_t l = 0; l != Lanes; ++l) {
+				hasher_t h{};
+				keccak::store_lane(states, l, h.internal_state);
+				h.squeeze(typename hasher_t::digest_span_t(output[l]));
+			}
+			return output;
+		}
+	};
+
+	// number of SHA-2 lanes which fits 256 bit vector, and four keccak states (one 256 bit vector per lane of the state)
+	template <typename Hasher> constexpr size_t default_lanes_of = 1u;
+	template <typename Config> constexpr size_t default_lanes_of<hasher<Config>> = 32u / sizeof(typename internal_hasher<Config>::state_item_t);
+	template <typename Config> constexpr size_t default_lanes_of<keccak_hasher<Config>> = 32u / sizeof(keccak::state_1600::value_type);
+
+} // namespace internal
+
+// hash of input with size known during compilation (eg. merkle tree nodes, digests of digests)
+template <typename Hasher, size_t N, byte_like Byte> constexpr auto hash_fixed(std::span<const Byte, N> in) noexcept {
+	return internal::fixed_size_hashing<Hasher, N>::calculate(in);
+}
+
+template <typename Hasher, size_t N, byte_like Byte> constexpr auto hash_fixed(std::span<Byte, N> in) noexcept {
+	return hash_fixed<Hasher>(std::span<const Byte, N>(in));
+}
+
+template <typename Hasher, size_t N, byte_like Byte> constexpr auto hash_fixed(const std::array<Byte, N> & in) noexcept {
+	return hash_fixed<Hasher>(std::span<const Byte, N>(in));
+}
+
+template <typename Hasher, size_t N> constexpr auto hash_fixed(const hash_value<N> & in) noexcept {
+	return hash_fixed<Hasher>(std::span<const std::byte, N>(in.data(), N));
+}
+
+// multiple inputs of the same size at once
+template <typename Hasher, size_t N, byte_like Byte, size_t Lanes> constexpr auto hash_fixed_lanes(const std::array<std::span<const Byte, N>, Lanes> & in) noexcept {
+	return internal::fixed_size_hashing<Hasher, N>::template calculate_lanes<Lanes, Byte>(in);
+}
+
+// many inputs of the same size, `Lanes` of them are hashed together
+template <typename Hasher, size_t Lanes = internal::default_lanes_of<Hasher>, size_t N, byte_like Byte> constexpr void hash_fixed_many(std::span<const std::array<Byte, N>> in, std::span<typename Hasher::result_t> out) noexcept {
+	assert(in.size() == out.size());
+	size_t i = 0;
+
+	if constexpr (Lanes > 1u) {
+		for (; (in.size() - i) >= Lanes; i += Lanes) {
+			const auto views = [&]<size_t... Idx>(std::index_sequence<Idx...>) {
+				return std::array{std::span<const Byte, N>(in[i + Idx])...};
+			}(std::make_index_sequence<Lanes>());
+
+			const auto results = hash_fixed_lanes<Hasher>(views);
+			std::copy(results.begin(), results.end(), out.begin() + static_cast<std::ptrdiff_t>(i));
+		}
+	}
+
+	for (; i != in.size(); ++i) {
+		out[i] = hash_fixed<Hasher>(in[i]);
+	}
+}
+
+} // namespace cthash
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef CONSTEXPR_SHA2_HASHER_HPP
 #define CONSTEXPR_SHA2_HASHER_HPP
 
+#include "midstate.hpp"
 #include "simple.hpp"
 #include "value.hpp"
 #include "internal/bit.hpp"
@@ -12,6 +13,7 @@
 #include <span>
 #include <cassert>
 #include <concepts>
+#include <optional>
 #include <cstdint>
 
 namespace cthash {
@@ -45,17 +47,51 @@ template <typename Config> struct internal_hasher {
 	unsigned block_used;
 
 	// constructors
-	constexpr internal_hasher() noexcept: hash{config.initial_values}, total_length{0u}, block_used{0u} { }
+	constexpr internal_hasher() noexcept: hash{config.initial_values}, total_length{0u}, block_used{0u} {
+		// only during constant evaluation, so the hasher can be stored in a constexpr variable (eg. midstate)
+		if consteval {
+			std::fill(block.begin(), block.end(), std::byte{0x0u});
+		}
+	}
 	constexpr internal_hasher(const internal_hasher &) noexcept = default;
 	constexpr internal_hasher(internal_hasher &&) noexcept = default;
+	constexpr internal_hasher & operator=(const internal_hasher &) noexcept = default;
+	constexpr internal_hasher & operator=(internal_hasher &&) noexcept = default;
 	constexpr ~internal_hasher() noexcept = default;
 
+	// content of block is not needed as `block_used` is zero
+	constexpr void reset() noexcept {
+		hash = config.initial_values;
+		total_length = 0u;
+		block_used = 0u;
+	}
+
 	// take buffer and build staging
 	template <byte_like Byte> [[gnu::always_inline]] static constexpr auto build_staging(std::span<const Byte, block_size_bytes> chunk) noexcept -> staging_value_t {
 		staging_value_t w;
 
 		constexpr auto first_part_size = block_size_bytes / sizeof(staging_item_t);
 
+		// word by word without helper lambdas, spans and array accessors (each of them costs evaluation steps)
+		if consteval {
+			const Byte * in = chunk.data();
+			staging_item_t * out = w.data();
+
+			for (size_t i = 0; i != first_part_size; ++i) {
+				staging_item_t v = 0u;
+				for (size_t j = 0; j != sizeof(staging_item_t); ++j) {
+					v = static_cast<staging_item_t>((v << 8u) | static_cast<uint8_t>(*in++));
+				}
+				out[i] = v;
+			}
+
+			for (size_t i = first_part_size; i != staging_size; ++i) {
+				out[i] = out[i - 16u] + config.sigma_0(out[i - 15u]) + out[i - 7u] + config.sigma_1(out[i - 2u]);
+			}
+
+			return w;
+		}
+
 		// fill first part with chunk
 		for (int i = 0; i != int(first_part_size); ++i) {
 			w[static_cast<size_t>(i)] = cast_from_bytes<staging_item_t>(chunk.subspan(static_cast<size_t>(i) * sizeof(staging_item_t)).template first<sizeof(staging_item_t)>());
@@ -130,6 +166,23 @@ template <typename Config> struct internal_hasher {
 		}
 	}
 
+	// input is gathered directly into block
+	template <std::input_iterator It, std::sentinel_for<It> Sentinel> constexpr void update_from_iterator(It it, const Sentinel & end) noexcept {
+		for (;;) {
+			const size_t copied = byte_copy_some(it, end, std::span<std::byte>(block).subspan(block_used));
+			block_used += static_cast<unsigned>(copied);
+			total_length += copied;
+
+			if (block_used != block_size_bytes) {
+				return;
+			}
+
+			const staging_value_t w = build_staging(block);
+			rounds(w, hash);
+			block_used = 0u;
+		}
+	}
+
 	[[gnu::always_inline]] static constexpr bool finalize_buffer(block_value_t & block, size_t block_used) noexcept {
 		assert(block_used < block.size());
 		const auto free_space = std::span(block).subspan(block_used);
@@ -193,6 +246,59 @@ template <typename Config> struct internal_hasher {
 
 		std::copy_n(tmp_buffer.data(), digest_bytes, out.data());
 	}
+
+	// state export (see midstate.hpp for the format)
+	static constexpr size_t exported_state_size = hasher_state_header::size + config.initial_values.size() * sizeof(state_item_t) + sizeof(uint64_t) + block_size_bytes;
+
+	static_assert(sizeof(length_t) <= sizeof(uint64_t));
+
+	static constexpr auto state_header() noexcept -> hasher_state_header {
+		hasher_state_header output{};
+		output.family = hasher_state_header::sha2_family;
+		output.digest_length = static_cast<uint32_t>(digest_bytes);
+		output.block_size = static_cast<uint32_t>(block_size_bytes);
+		output.variant = static_cast<uint32_t>(config.initial_values[0]);
+		return output;
+	}
+
+	constexpr void export_state_into(std::span<std::byte, exported_state_size> out) const noexcept {
+		state_header().write_into(out.template first<hasher_state_header::size>());
+		auto it = out.subspan(hasher_state_header::size);
+
+		for (state_item_t value: hash) {
+			unwrap_littleendian_number<state_item_t>{it.template first<sizeof(state_item_t)>()} = value;
+			it = it.subspan(sizeof(state_item_t));
+		}
+
+		unwrap_littleendian_number<uint64_t>{it.template first<sizeof(uint64_t)>()} = static_cast<uint64_t>(total_length);
+		it = it.subspan(sizeof(uint64_t));
+
+		const auto used = std::span<const std::byte, block_size_bytes>(block).first(block_used);
+		const auto rest = std::copy(used.begin(), used.end(), it.begin());
+		std::fill(rest, it.end(), std::byte{0});
+	}
+
+	// state is modified only if input is valid
+	constexpr bool import_state_from(std::span<const std::byte> in) noexcept {
+		if (in.size() != exported_state_size || hasher_state_header::read_from(in) != state_header()) {
+			return false;
+		}
+
+		auto it = in.subspan(hasher_state_header::size);
+
+		for (state_item_t & value: hash) {
+			value = cast_from_le_bytes<state_item_t>(it.template first<sizeof(state_item_t)>());
+			it = it.subspan(sizeof(state_item_t));
+		}
+
+		total_length = static_cast<length_t>(cast_from_le_bytes<uint64_t>(it.template first<sizeof(uint64_t)>()));
+		it = it.subspan(sizeof(uint64_t));
+
+		block_used = static_cast<unsigned>(total_length % block_size_bytes);
+		std::copy(it.begin(), it.end(), block.begin());
+
+		return true;
+	}
 };
 
 // this is a convinience type for nicer UX...
@@ -202,9 +308,13 @@ template <typename Config> struct hasher: private internal_hasher<Config> {
 	using length_t = typename super::length_t;
 	using digest_span_t = typename super::digest_span_t;
 
+	using super::block_size_bytes;
+
 	constexpr hasher() noexcept: super() { }
 	constexpr hasher(const hasher &) noexcept = default;
 	constexpr hasher(hasher &&) noexcept = default;
+	constexpr hasher & operator=(const hasher &) noexcept = default;
+	constexpr hasher & operator=(hasher &&) noexcept = default;
 	constexpr ~hasher() noexcept = default;
 
 	// support for various input types
@@ -229,7 +339,18 @@ template <typename Config> struct hasher: private internal_hasher<Config> {
 		return *this;
 	}
 
-	// TODO: any range with value convertible to byte
+	// fragments are processed one by one, only bytes straddling fragment boundary are copied into block
+	template <byte_span_fragments T> constexpr hasher & update(const T & fragments) noexcept {
+		for (const auto & fragment: fragments) {
+			super::update_to_buffer_and_process(fragment_bytes(fragment));
+		}
+		return *this;
+	}
+
+	template <byte_input_range R> constexpr hasher & update(R && range) noexcept {
+		super::update_from_iterator(std::ranges::begin(range), std::ranges::end(range));
+		return *this;
+	}
 
 	// output (by reference or by value)
 	constexpr void final(digest_span_t digest) noexcept {
@@ -243,9 +364,37 @@ template <typename Config> struct hasher: private internal_hasher<Config> {
 		return output;
 	}
 
+	// final and reset, so the hasher can be reused for another message
+	constexpr void hash_into(digest_span_t digest) noexcept {
+		this->final(digest);
+		reset();
+	}
+
+	constexpr hasher & reset() noexcept {
+		super::reset();
+		return *this;
+	}
+
 	constexpr length_t size() const noexcept {
 		return super::total_length;
 	}
+
+	// portable snapshot of state (to checkpoint or to share a midstate)
+	static constexpr size_t exported_state_size = super::exported_state_size;
+
+	constexpr auto export_state() const noexcept -> std::array<std::byte, exported_state_size> {
+		std::array<std::byte, exported_state_size> output;
+		super::export_state_into(output);
+		return output;
+	}
+
+	static constexpr auto import_state(std::span<const std::byte> in) noexcept -> std::optional<hasher> {
+		hasher output{};
+		if (!output.import_state_from(in)) {
+			return std::nullopt;
+		}
+		return output;
+	}
 };
 
 } // namespace cthash
@@ -0,0 +1,53 @@
+#ifndef CTHASH_HKDF_HPP
+#define CTHASH_HKDF_HPP
+
+#include "hmac.hpp"
+#include "value.hpp"
+#include <algorithm>
+#include <array>
+#include <span>
+#include <cassert>
+#include <cstddef>
+
+namespace cthash {
+
+// HKDF (RFC 5869) extract: PRK = HMAC(salt, IKM), empty salt is same as salt of zeros
+template <typename Hasher, typename Salt, typename Input> constexpr auto hkdf_extract(const Salt & salt, const Input & ikm) noexcept {
+	return hmac<Hasher>{salt}.update(ikm).final();
+}
+
+// HKDF expand: T(i) = HMAC(PRK, T(i-1) || info || i), output is at most 255 digests long
+template <typename Hasher, typename Info> constexpr void hkdf_expand(std::span<std::byte> output, const hmac_key<Hasher> & prk, const Info & info) noexcept {
+	using result_t = typename hmac<Hasher>::result_t;
+	assert(output.size() <= 255u * result_t::digest_length);
+
+	result_t previous;
+	auto counter = std::array<std::byte, 1>{std::byte{0}};
+
+	for (size_t offset = 0; offset < output.size(); offset += result_t::digest_length) {
+		auto h = hmac<Hasher>{prk};
+		if (offset != 0u) {
+			h.update(std::span<const std::byte>(previous));
+		}
+
+		counter[0] = static_cast<std::byte>(static_cast<unsigned>(counter[0]) + 1u);
+		previous = h.update(info).update(std::span<const std::byte>(counter)).final();
+
+		std::copy_n(previous.begin(), std::min(result_t::digest_length, output.size() - offset), output.begin() + static_cast<std::ptrdiff_t>(offset));
+	}
+}
+
+template <typename Hasher, size_t N, typename Prk, typename Info> constexpr auto hkdf_expand(const Prk & prk, const Info & info) noexcept -> hash_value<N> {
+	hash_value<N> output;
+	hkdf_expand<Hasher>(std::span<std::byte>(output), hmac_key<Hasher>{prk}, info);
+	return output;
+}
+
+// extract and expand together
+template <typename Hasher, size_t N = Hasher::result_t::digest_length, typename Input, typename Salt, typename Info> constexpr auto hkdf(const Input & ikm, const Salt & salt, const Info & info) noexcept -> hash_value<N> {
+	return hkdf_expand<Hasher, N>(hkdf_extract<Hasher>(salt, ikm), info);
+}
+
+} // namespace cthash
+
+#endif
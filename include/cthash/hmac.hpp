@@ -0,0 +1,137 @@
+#ifndef CTHASH_HMAC_HPP
+#define CTHASH_HMAC_HPP
+
+#include "value.hpp"
+#include "internal/concepts.hpp"
+#include "internal/convert.hpp"
+#include <algorithm>
+#include <array>
+#include <span>
+#include <string_view>
+#include <cstddef>
+
+namespace cthash {
+
+template <typename Hasher> concept hmac_compatible_hasher = requires(Hasher & h) //
+{
+	{ Hasher::block_size_bytes } -> std::convertible_to<size_t>;
+	{ h.final() };
+};
+
+template <hmac_compatible_hasher Hasher> struct hmac_tag {
+	static constexpr size_t digest_length = Hasher::result_t::digest_length;
+};
+
+namespace internal {
+
+	// long keys are hashed first, short keys are padded with zeros
+	template <typename Hasher, byte_like T> constexpr auto hmac_padded_key(std::span<const T> key) noexcept -> std::array<std::byte, Hasher::block_size_bytes> {
+		std::array<std::byte, Hasher::block_size_bytes> block{};
+
+		if (key.size() > block.size()) {
+			static_assert(Hasher::result_t::digest_length <= Hasher::block_size_bytes);
+			const auto digest = Hasher{}.update(key).final();
+			std::copy(digest.begin(), digest.end(), block.begin());
+		} else {
+			byte_copy(key.begin(), key.end(), block.begin());
+		}
+
+		return block;
+	}
+
+	template <size_t N> constexpr void xor_with(std::array<std::byte, N> & block, std::byte value) noexcept {
+		for (std::byte & b: block) {
+			b ^= value;
+		}
+	}
+
+	inline constexpr auto hmac_ipad = std::byte{0x36u};
+	inline constexpr auto hmac_opad = std::byte{0x5cu};
+
+} // namespace internal
+
+// key with inner (K ^ ipad) and outer (K ^ opad) blocks already absorbed, so each MAC costs only message blocks and two finalizations
+template <hmac_compatible_hasher Hasher> struct hmac_key {
+	static constexpr size_t block_size = Hasher::block_size_bytes;
+
+	Hasher inner{};
+	Hasher outer{};
+
+	explicit constexpr hmac_key(std::span<const std::byte> key) noexcept {
+		absorb_key(key);
+	}
+
+	template <convertible_to_byte_span T> explicit constexpr hmac_key(const T & key) noexcept {
+		using value_type = typename decltype(std::span(key))::value_type;
+		absorb_key(std::span<const value_type>(key));
+	}
+
+	template <one_byte_char CharT> explicit constexpr hmac_key(std::basic_string_view<CharT> key) noexcept {
+		absorb_key(std::span(key.data(), key.size()));
+	}
+
+	template <string_literal T> explicit constexpr hmac_key(const T & key) noexcept {
+		absorb_key(std::span(key, std::size(key) - 1u));
+	}
+
+	template <typename T> constexpr auto calculate(const T & message) const noexcept;
+
+private:
+	template <byte_like T> constexpr void absorb_key(std::span<const T> key) noexcept {
+		auto block = internal::hmac_padded_key<Hasher>(key);
+
+		internal::xor_with(block, internal::hmac_ipad);
+		inner.update(std::span<const std::byte>(block));
+
+		internal::xor_with(block, internal::hmac_ipad ^ internal::hmac_opad);
+		outer.update(std::span<const std::byte>(block));
+	}
+};
+
+template <hmac_compatible_hasher Hasher> struct hmac {
+	using result_t = cthash::tagged_hash_value<hmac_tag<Hasher>>;
+	using digest_span_t = std::span<std::byte, result_t::digest_length>;
+
+	Hasher inner;
+	Hasher outer;
+
+	explicit constexpr hmac(const hmac_key<Hasher> & key) noexcept: inner{key.inner}, outer{key.outer} { }
+	template <typename T> explicit constexpr hmac(const T & key) noexcept: hmac(hmac_key<Hasher>{key}) { }
+	constexpr hmac(const hmac &) noexcept = default;
+	constexpr hmac(hmac &&) noexcept = default;
+	constexpr ~hmac() noexcept = default;
+
+	// support for various input types (same as the hasher)
+	constexpr hmac & update(std::span<const std::byte> input) noexcept {
+		inner.update(input);
+		return *this;
+	}
+
+	template <typename T> constexpr hmac & update(const T & something) noexcept {
+		inner.update(something);
+		return *this;
+	}
+
+	// output (by reference or by value)
+	constexpr void final(digest_span_t digest) noexcept {
+		inner.final(digest);
+		outer.update(std::span<const std::byte>(digest));
+		outer.final(digest);
+	}
+
+	constexpr auto final() noexcept {
+		result_t output;
+		this->final(output);
+		return output;
+	}
+};
+
+template <typename Hasher> hmac(const hmac_key<Hasher> &) -> hmac<Hasher>;
+
+template <hmac_compatible_hasher Hasher> template <typename T> constexpr auto hmac_key<Hasher>::calculate(const T & message) const noexcept {
+	return hmac<Hasher>{*this}.update(message).final();
+}
+
+} // namespace cthash
+
+#endif
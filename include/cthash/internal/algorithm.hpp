@@ -1,14 +1,38 @@
 #ifndef CTHASH_INTERNAL_ALGORITHM_HPP
 #define CTHASH_INTERNAL_ALGORITHM_HPP
 
+#include "convert.hpp"
 #include <numeric>
+#include <span>
+#include <type_traits>
 #include <compare>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 namespace cthash::internal {
 
+template <typename T> concept pointer_to_unsigned_byte = std::is_pointer_v<T> && (std::same_as<std::remove_cv_t<std::remove_pointer_t<T>>, std::byte> || std::same_as<std::remove_cv_t<std::remove_pointer_t<T>>, unsigned char> || std::same_as<std::remove_cv_t<std::remove_pointer_t<T>>, char8_t>);
+
 template <typename It1, typename It2> constexpr auto threeway_compare_of_same_size(It1 lhs, It2 rhs, size_t length) -> std::strong_ordering {
+	if constexpr (pointer_to_unsigned_byte<It1> && pointer_to_unsigned_byte<It2>) {
+		if !consteval {
+			// big-endian load keeps ordering of bytes, so we can compare whole words
+			while (length >= sizeof(uint64_t)) {
+				const auto l = cast_from_bytes<uint64_t>(std::span<const std::remove_cv_t<std::remove_pointer_t<It1>>, sizeof(uint64_t)>(lhs, sizeof(uint64_t)));
+				const auto r = cast_from_bytes<uint64_t>(std::span<const std::remove_cv_t<std::remove_pointer_t<It2>>, sizeof(uint64_t)>(rhs, sizeof(uint64_t)));
+
+				if (l != r) {
+					return l <=> r;
+				}
+
+				lhs += sizeof(uint64_t);
+				rhs += sizeof(uint64_t);
+				length -= sizeof(uint64_t);
+			}
+		}
+	}
+
 	for (size_t i = 0; i != length; ++i) {
 		if (const auto r = (*lhs++ <=> *rhs++); std::is_neq(r)) {
 			return r;
@@ -18,6 +42,95 @@ template <typename It1, typename It2> constexpr auto threeway_compare_of_same_si
 	return std::strong_ordering::equal;
 }
 
+// native-endian load, only usable in runtime and only for equality
+template <pointer_to_unsigned_byte It> inline auto load_word(It ptr) noexcept -> uint64_t {
+	uint64_t output;
+	std::memcpy(&output, ptr, sizeof(uint64_t));
+	return output;
+}
+
+// OR of XORs of `Words` consecutive words, there is no branch inside so compilers emit vector compare
+template <size_t Words, pointer_to_unsigned_byte It1, pointer_to_unsigned_byte It2> [[gnu::always_inline]] inline auto difference_of_words(It1 lhs, It2 rhs) noexcept -> uint64_t {
+	uint64_t output = 0u;
+	for (size_t i = 0; i != Words; ++i) {
+		output |= load_word(lhs + i * sizeof(uint64_t)) ^ load_word(rhs + i * sizeof(uint64_t));
+	}
+	return output;
+}
+
+// prevent compiler from reasoning about the value (and turning accumulation into early exit)
+inline void value_barrier(uint64_t & value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+	__asm__ volatile("" : "+r"(value));
+#else
+	volatile uint64_t copy = value;
+	value = copy;
+#endif
+}
+
+template <typename It1, typename It2> constexpr bool equal_of_same_size(It1 lhs, It2 rhs, size_t length) noexcept {
+	if constexpr (pointer_to_unsigned_byte<It1> && pointer_to_unsigned_byte<It2>) {
+		if !consteval {
+			// 32 bytes at once, exit early only between these chunks
+			while (length >= 4u * sizeof(uint64_t)) {
+				if (difference_of_words<4u>(lhs, rhs) != 0u) {
+					return false;
+				}
+
+				lhs += 4u * sizeof(uint64_t);
+				rhs += 4u * sizeof(uint64_t);
+				length -= 4u * sizeof(uint64_t);
+			}
+
+			while (length >= sizeof(uint64_t)) {
+				if (difference_of_words<1u>(lhs, rhs) != 0u) {
+					return false;
+				}
+
+				lhs += sizeof(uint64_t);
+				rhs += sizeof(uint64_t);
+				length -= sizeof(uint64_t);
+			}
+		}
+	}
+
+	for (size_t i = 0; i != length; ++i) {
+		if (*lhs++ != *rhs++) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// time of comparison doesn't depend on content or on position of first difference
+template <typename It1, typename It2> constexpr bool constant_time_equal_of_same_size(It1 lhs, It2 rhs, size_t length) noexcept {
+	uint64_t difference = 0u;
+
+	if constexpr (pointer_to_unsigned_byte<It1> && pointer_to_unsigned_byte<It2>) {
+		if !consteval {
+			while (length >= sizeof(uint64_t)) {
+				difference |= difference_of_words<1u>(lhs, rhs);
+				value_barrier(difference);
+
+				lhs += sizeof(uint64_t);
+				rhs += sizeof(uint64_t);
+				length -= sizeof(uint64_t);
+			}
+		}
+	}
+
+	for (size_t i = 0; i != length; ++i) {
+		difference |= static_cast<uint64_t>(static_cast<uint8_t>(*lhs++) ^ static_cast<uint8_t>(*rhs++));
+	}
+
+	if !consteval {
+		value_barrier(difference);
+	}
+
+	return difference == 0u;
+}
+
 template <typename T, typename It1, typename It2, typename Stream> constexpr auto & push_to_stream_as(It1 f, It2 l, Stream & stream) {
 	constexpr auto cast_and_shift = [](Stream * s, const auto & rhs) { (*s) << T{rhs}; return s; };
 	return *std::accumulate(f, l, &stream, cast_and_shift);
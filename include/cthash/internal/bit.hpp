@@ -2,6 +2,9 @@
 #define CTHASH_INTERNAL_BIT_HPP
 
 #include <bit>
+#include <concepts>
+#include <type_traits>
+#include <cstdint>
 
 namespace cthash::internal {
 
@@ -33,6 +36,8 @@ template <unsigned_integral_of_size<8> T> constexpr auto byteswap(T val) noexcep
 
 #endif
 
+template <size_t Bytes> using unsigned_integral_for_bytes = std::conditional_t<(Bytes <= 1u), uint8_t, std::conditional_t<(Bytes <= 2u), uint16_t, std::conditional_t<(Bytes <= 4u), uint32_t, uint64_t>>>;
+
 } // namespace cthash::internal
 
 #endif
\ No newline at end of file
@@ -1,7 +1,10 @@
 #ifndef CTHASH_CONCEPTS_HPP
 #define CTHASH_CONCEPTS_HPP
 
+#include <ranges>
 #include <span>
+#include <type_traits>
+#include <cstddef>
 
 namespace cthash {
 
@@ -23,6 +26,21 @@ template <typename T> concept convertible_to_byte_span = requires(T && obj) //
 	requires !string_literal<T>;
 };
 
+// POSIX `struct iovec` and similar (base pointer + length)
+template <typename T> concept iovec_like = requires(const T & obj) //
+{
+	{ obj.iov_base } -> std::convertible_to<const void *>;
+	{ obj.iov_len } -> std::convertible_to<size_t>;
+};
+
+template <typename T> concept byte_span_fragment = convertible_to_byte_span<T> || iovec_like<T>;
+
+// scatter-gather input (eg. span of iovecs or a rope of string_views)
+template <typename T> concept byte_span_fragments = std::ranges::input_range<T> && byte_span_fragment<std::ranges::range_reference_t<T>> && !convertible_to_byte_span<T>;
+
+// any other range of bytes (generators, istreambuf_iterator ranges, views), it's read only once
+template <typename T> concept byte_input_range = std::ranges::input_range<T> && byte_like<std::ranges::range_value_t<T>> && !convertible_to_byte_span<T> && !string_literal<std::remove_cvref_t<T>>;
+
 } // namespace cthash
 
 #endif
@@ -3,6 +3,8 @@
 
 #include "bit.hpp"
 #include "concepts.hpp"
+#include <algorithm>
+#include <iterator>
 #include <span>
 #include <type_traits>
 #include <cstddef>
@@ -15,6 +17,32 @@ template <typename It1, typename It2, typename It3> constexpr auto byte_copy(It1
 	return std::transform(first, last, destination, [](byte_like auto v) { return static_cast<std::byte>(v); });
 }
 
+// copies from the iterator until output is full or input is exhausted, returns number of copied bytes
+template <std::input_iterator It, std::sentinel_for<It> Sentinel> constexpr auto byte_copy_some(It & it, const Sentinel & end, std::span<std::byte> output) noexcept -> size_t {
+	if constexpr (std::sized_sentinel_for<Sentinel, It>) {
+		const size_t n = std::min(output.size(), static_cast<size_t>(end - it));
+		for (size_t i = 0; i != n; ++i, ++it) {
+			output[i] = static_cast<std::byte>(*it);
+		}
+		return n;
+	} else {
+		size_t n = 0u;
+		for (; n != output.size() && it != end; ++n, ++it) {
+			output[n] = static_cast<std::byte>(*it);
+		}
+		return n;
+	}
+}
+
+template <byte_span_fragment T> constexpr auto fragment_bytes(const T & fragment) noexcept {
+	if constexpr (iovec_like<T>) {
+		return std::span<const std::byte>(static_cast<const std::byte *>(fragment.iov_base), static_cast<size_t>(fragment.iov_len));
+	} else {
+		using value_type = typename decltype(std::span(fragment))::value_type;
+		return std::span<const value_type>(fragment);
+	}
+}
+
 template <std::unsigned_integral T, byte_like Byte> constexpr auto cast_from_bytes(std::span<const Byte, sizeof(T)> in) noexcept -> T {
 	if consteval {
 		return [&]<size_t... Idx>(std::index_sequence<Idx...>) -> T {
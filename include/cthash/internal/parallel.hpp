@@ -0,0 +1,33 @@
+#ifndef CTHASH_INTERNAL_PARALLEL_HPP
+#define CTHASH_INTERNAL_PARALLEL_HPP
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include <cstddef>
+
+namespace cthash::internal {
+
+// calls `fn(first, last)` for up to `threads` ranges of [0, count), ranges are aligned to `lanes` and the current thread
+// calculates the first one, `fn` must not throw
+template <typename Fn> void parallel_for_lanes(size_t count, size_t threads, size_t lanes, Fn && fn) {
+	const size_t chunk = (count / threads + lanes - 1u) / lanes * lanes;
+
+	// jthread joins in destructor, so already started workers are joined also when creation of another one throws
+	std::vector<std::jthread> workers;
+	workers.reserve(threads - 1u);
+
+	for (size_t first = chunk; first < count; first += chunk) {
+		workers.emplace_back([&fn, first, last = std::min(first + chunk, count)] { fn(first, last); });
+	}
+
+	fn(size_t{0u}, std::min(chunk, count));
+
+	for (std::jthread & t: workers) {
+		t.join();
+	}
+}
+
+} // namespace cthash::internal
+
+#endif
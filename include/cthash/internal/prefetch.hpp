@@ -0,0 +1,27 @@
+#ifndef CTHASH_INTERNAL_PREFETCH_HPP
+#define CTHASH_INTERNAL_PREFETCH_HPP
+
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+namespace cthash::internal {
+
+// only a hint, it's a no-op when evaluated at compile time or when not supported by compiler
+[[gnu::always_inline]] constexpr void prefetch(const void * ptr) noexcept {
+	if !consteval {
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(ptr);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		_mm_prefetch(static_cast<const char *>(ptr), _MM_HINT_T0);
+#else
+		(void)ptr;
+#endif
+	} else {
+		(void)ptr;
+	}
+}
+
+} // namespace cthash::internal
+
+#endif
@@ -0,0 +1,161 @@
+#ifndef CTHASH_MIDSTATE_HPP
+#define CTHASH_MIDSTATE_HPP
+
+#include "fixed-string.hpp"
+#include "internal/convert.hpp"
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+
+namespace cthash {
+
+// exported hasher state: 32 bytes of header (all numbers are little-endian) followed by family specific state
+//   0: "cthstate"
+//   8: u32 version
+//  12: u32 family (0 = sha-2, 1 = keccak)
+//  16: u32 digest length (in bytes, zero for XOF)
+//  20: u32 block size (sha-2) or rate (keccak) in bytes
+//  24: u32 variant (sha-2: low 32 bits of first initial value, keccak: suffix with first padding bit, and number of
+//      rounds shifted by 8 bits when it is not 24)
+//  28: u32 reserved (zero)
+// sha-2 state:
+//  32: state words (little-endian)
+//   +: u64 total length (in bytes)
+//   +: block (only first `total length % block size` bytes are meaningful, rest is zero)
+// keccak state:
+//  32: 25x u64 lanes (little-endian)
+// 232: u32 position in rate
+// 236: u32 reserved (zero)
+struct hasher_state_header {
+	static constexpr size_t size = 32u;
+	static constexpr uint32_t current_version = 1u;
+	static constexpr auto magic = std::array<char, 8>{'c', 't', 'h', 's', 't', 'a', 't', 'e'};
+
+	static constexpr uint32_t sha2_family = 0u;
+	static constexpr uint32_t keccak_family = 1u;
+
+	uint32_t version{current_version};
+	uint32_t family{0u};
+	uint32_t digest_length{0u};
+	uint32_t block_size{0u};
+	uint32_t variant{0u};
+
+	constexpr friend bool operator==(const hasher_state_header &, const hasher_state_header &) noexcept = default;
+
+	constexpr void write_into(std::span<std::byte, size> out) const noexcept {
+		std::fill(out.begin(), out.end(), std::byte{0});
+		std::transform(magic.begin(), magic.end(), out.begin(), [](char c) { return static_cast<std::byte>(c); });
+		unwrap_littleendian_number<uint32_t>{out.subspan<8u, 4u>()} = version;
+		unwrap_littleendian_number<uint32_t>{out.subspan<12u, 4u>()} = family;
+		unwrap_littleendian_number<uint32_t>{out.subspan<16u, 4u>()} = digest_length;
+		unwrap_littleendian_number<uint32_t>{out.subspan<20u, 4u>()} = block_size;
+		unwrap_littleendian_number<uint32_t>{out.subspan<24u, 4u>()} = variant;
+	}
+
+	static constexpr auto read_from(std::span<const std::byte> in) noexcept -> std::optional<hasher_state_header> {
+		if (in.size() < size) {
+			return std::nullopt;
+		}
+
+		if (!std::equal(magic.begin(), magic.end(), in.begin(), [](char c, std::byte b) { return static_cast<std::byte>(c) == b; })) {
+			return std::nullopt;
+		}
+
+		hasher_state_header output{};
+		output.version = cast_from_le_bytes<uint32_t>(in.subspan<8u, 4u>());
+		output.family = cast_from_le_bytes<uint32_t>(in.subspan<12u, 4u>());
+		output.digest_length = cast_from_le_bytes<uint32_t>(in.subspan<16u, 4u>());
+		output.block_size = cast_from_le_bytes<uint32_t>(in.subspan<20u, 4u>());
+		output.variant = cast_from_le_bytes<uint32_t>(in.subspan<24u, 4u>());
+
+		if (output.version != current_version) {
+			return std::nullopt;
+		}
+
+		return output;
+	}
+};
+
+// hasher which already absorbed a common prefix, every message starts from a copy of the midstate
+template <typename Hasher> struct prefixed_hasher {
+	using hasher_t = Hasher;
+
+	Hasher midstate{};
+
+	constexpr prefixed_hasher() noexcept = default;
+	explicit constexpr prefixed_hasher(const Hasher & h) noexcept: midstate{h} { }
+	template <typename T> explicit constexpr prefixed_hasher(const T & prefix) noexcept {
+		midstate.update(prefix);
+	}
+
+	// hasher with prefix already absorbed (use it for multiple updates or XOF output)
+	constexpr auto start() const noexcept -> Hasher {
+		return midstate;
+	}
+
+	template <typename T> constexpr auto calculate(const T & message) const noexcept {
+		Hasher h = midstate;
+		h.update(message);
+		return h.final();
+	}
+
+	constexpr auto export_state() const noexcept {
+		return midstate.export_state();
+	}
+
+	static constexpr auto import_state(std::span<const std::byte> in) noexcept -> std::optional<prefixed_hasher> {
+		if (const auto h = Hasher::import_state(in)) {
+			return prefixed_hasher{*h};
+		}
+		return std::nullopt;
+	}
+};
+
+// hasher which starts from a midstate of constant prefix, all full blocks of the prefix are compressed during compilation
+// and the rest stays in the buffer
+template <typename Hasher, fixed_string Prefix> struct with_prefix: Hasher {
+	using super = Hasher;
+
+	static constexpr auto prefix = Prefix;
+	static constexpr Hasher midstate = [] {
+		Hasher h{};
+		h.update(std::basic_string_view(Prefix.data(), Prefix.size()));
+		return h;
+	}();
+
+	constexpr with_prefix() noexcept: super{midstate} { }
+	constexpr with_prefix(const with_prefix &) noexcept = default;
+	constexpr with_prefix(with_prefix &&) noexcept = default;
+	constexpr with_prefix & operator=(const with_prefix &) noexcept = default;
+	constexpr with_prefix & operator=(with_prefix &&) noexcept = default;
+	constexpr ~with_prefix() noexcept = default;
+
+	template <typename T> constexpr with_prefix & update(const T & in) noexcept {
+		super::update(in);
+		return *this;
+	}
+
+	constexpr with_prefix & update(std::span<const std::byte> in) noexcept {
+		super::update(in);
+		return *this;
+	}
+
+	// back to the midstate (not to empty hasher)
+	constexpr with_prefix & reset() noexcept {
+		static_cast<Hasher &>(*this) = midstate;
+		return *this;
+	}
+
+	constexpr void hash_into(typename Hasher::digest_span_t digest) noexcept {
+		super::final(digest);
+		reset();
+	}
+};
+
+} // namespace cthash
+
+#endif
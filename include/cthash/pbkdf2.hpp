@@ -0,0 +1,252 @@
+#ifndef CTHASH_PBKDF2_HPP
+#define CTHASH_PBKDF2_HPP
+
+#include "hasher.hpp"
+#include "hmac.hpp"
+#include "value.hpp"
+#include "sha2/lanes.hpp"
+#include <algorithm>
+#include <array>
+#include <span>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace cthash {
+
+namespace internal {
+
+	template <typename T> constexpr auto byte_span_of(const T & in) noexcept {
+		if constexpr (string_literal<T>) {
+			return std::span(in, std::size(in) - 1u);
+		} else {
+			using value_type = typename decltype(std::span(in))::value_type;
+			return std::span<const value_type>(in);
+		}
+	}
+
+	template <typename> struct sha2_config_of { };
+	template <typename Config> struct sha2_config_of<hasher<Config>> {
+		using type = Config;
+	};
+
+	// PBKDF2 iterations can skip `update()` only when digest is made of whole state words
+	template <typename Hasher> concept sha2_hasher_with_aligned_digest = requires() {
+		typename sha2_config_of<Hasher>::type;
+	} && (internal_hasher<typename sha2_config_of<Hasher>::type>::digest_bytes % sizeof(typename internal_hasher<typename sha2_config_of<Hasher>::type>::state_item_t) == 0u);
+
+	// `Lanes` independent HMAC chains over SHA-2 compression (see sha2/lanes.hpp)
+	template <typename Config, size_t Lanes> struct sha2_hmac_lanes: sha2::lanes<Config, Lanes> {
+		using super = sha2::lanes<Config, Lanes>;
+		using typename super::hasher_t;
+		using typename super::item_t;
+		using typename super::lane_t;
+		using typename super::state_t;
+		using typename super::block_t;
+		using super::block_words;
+		using super::compress;
+		using super::state_words;
+
+		static constexpr size_t digest_words = hasher_t::digest_bytes / sizeof(item_t);
+
+		// message of each HMAC is a digest, which fits into a single block with padding and length
+		static_assert(hasher_t::digest_bytes + 1u + Config::length_size_bits / 8u <= hasher_t::block_size_bytes);
+
+		using digest_t = std::array<lane_t, digest_words>;
+
+		// states after absorbing K ^ ipad and K ^ opad
+		state_t inner{};
+		state_t outer{};
+
+		constexpr void set_key(size_t lane, const std::array<std::byte, hasher_t::block_size_bytes> & padded_key) noexcept {
+			auto block = padded_key;
+
+			xor_with(block, hmac_ipad);
+			hasher_t ih{};
+			ih.update_to_buffer_and_process(std::span<const std::byte>(block));
+
+			xor_with(block, hmac_ipad ^ hmac_opad);
+			hasher_t oh{};
+			oh.update_to_buffer_and_process(std::span<const std::byte>(block));
+
+			for (size_t i = 0; i != state_words; ++i) {
+				inner[i][lane] = ih.hash[i];
+				outer[i][lane] = oh.hash[i];
+			}
+		}
+
+		// u = HMAC(K, u) directly with compression function, padding is constant
+		[[gnu::always_inline]] constexpr void hmac_of_digest(digest_t & u) const noexcept {
+			block_t block{};
+			std::copy(u.begin(), u.end(), block.begin());
+			block[digest_words].fill(item_t{0x80u} << (sizeof(item_t) * 8u - 8u));
+			block[block_words - 1u].fill(static_cast<item_t>((hasher_t::block_size_bytes + hasher_t::digest_bytes) * 8u));
+
+			state_t s = inner;
+			compress(block, s);
+			std::copy_n(s.begin(), digest_words, block.begin());
+
+			s = outer;
+			compress(block, s);
+			std::copy_n(s.begin(), digest_words, u.begin());
+		}
+
+		// t = u ^ HMAC(K, u) ^ HMAC(K, HMAC(K, u)) ^ ...
+		constexpr auto iterate(digest_t u, size_t iterations) const noexcept -> digest_t {
+			digest_t t = u;
+
+			for (size_t j = 1; j < iterations; ++j) {
+				hmac_of_digest(u);
+
+				for (size_t i = 0; i != digest_words; ++i) {
+					for (size_t l = 0; l != Lanes; ++l) {
+						t[i][l] ^= u[i][l];
+					}
+				}
+			}
+
+			return t;
+		}
+
+		template <typename Value> static constexpr void load(digest_t & out, size_t lane, const Value & digest) noexcept {
+			for (size_t i = 0; i != digest_words; ++i) {
+				out[i][lane] = cast_from_bytes<item_t>(std::span<const std::byte, sizeof(item_t)>(digest.data() + i * sizeof(item_t), sizeof(item_t)));
+			}
+		}
+
+		static constexpr auto store(const digest_t & in, size_t lane) noexcept -> std::array<std::byte, hasher_t::digest_bytes> {
+			std::array<std::byte, hasher_t::digest_bytes> output;
+			for (size_t i = 0; i != digest_words; ++i) {
+				unwrap_bigendian_number<item_t>{std::span(output).subspan(i * sizeof(item_t)).template first<sizeof(item_t)>()} = in[i][lane];
+			}
+			return output;
+		}
+	};
+
+	// number of lanes which fits 256 bit vector
+	template <typename Hasher> constexpr size_t pbkdf2_default_lanes = [] {
+		if constexpr (sha2_hasher_with_aligned_digest<Hasher>) {
+			return 32u / sizeof(typename internal_hasher<typename sha2_config_of<Hasher>::type>::state_item_t);
+		} else {
+			return 1u;
+		}
+	}();
+
+	// one output block of PBKDF2 (T_index), output can be shorter than digest
+	template <typename Hasher> struct pbkdf2_job {
+		const std::array<std::byte, Hasher::block_size_bytes> * padded_key;
+		uint32_t index;
+		std::span<std::byte> output;
+	};
+
+	// U_1 = HMAC(P, S || INT(index))
+	template <typename Hasher, typename Salt> constexpr auto pbkdf2_first(const pbkdf2_job<Hasher> & job, const Salt & salt) noexcept {
+		std::array<std::byte, 4> counter;
+		unwrap_bigendian_number<uint32_t>{counter} = job.index;
+
+		const auto key = hmac_key<Hasher>{std::span<const std::byte>(*job.padded_key)};
+		return hmac<Hasher>{key}.update(salt).update(std::span<const std::byte>(counter)).final();
+	}
+
+	template <typename Hasher, size_t Lanes, typename Salt> constexpr void pbkdf2_run(const std::array<pbkdf2_job<Hasher>, Lanes> & jobs, const Salt & salt, size_t iterations) noexcept {
+		assert(iterations >= 1u);
+
+		if constexpr (sha2_hasher_with_aligned_digest<Hasher>) {
+			using lanes_t = sha2_hmac_lanes<typename sha2_config_of<Hasher>::type, Lanes>;
+
+			lanes_t lanes{};
+			typename lanes_t::digest_t u{};
+
+			for (size_t l = 0; l != Lanes; ++l) {
+				lanes.set_key(l, *jobs[l].padded_key);
+				lanes_t::load(u, l, pbkdf2_first(jobs[l], salt));
+			}
+
+			const auto t = lanes.iterate(u, iterations);
+
+			for (size_t l = 0; l != Lanes; ++l) {
+				const auto result = lanes_t::store(t, l);
+				std::copy_n(result.begin(), jobs[l].output.size(), jobs[l].output.begin());
+			}
+		} else {
+			// any other hasher goes through HMAC interface
+			for (const pbkdf2_job<Hasher> & job: jobs) {
+				const auto key = hmac_key<Hasher>{std::span<const std::byte>(*job.padded_key)};
+
+				auto u = pbkdf2_first(job, salt);
+				auto t = u;
+
+				for (size_t j = 1; j < iterations; ++j) {
+					u = key.calculate(u);
+					std::transform(t.begin(), t.end(), u.begin(), t.begin(), [](std::byte lhs, std::byte rhs) { return lhs ^ rhs; });
+				}
+
+				std::copy_n(t.begin(), job.output.size(), job.output.begin());
+			}
+		}
+	}
+
+} // namespace internal
+
+// PBKDF2-HMAC (RFC 8018) into output of any length, multiple output blocks are computed in parallel lanes
+template <typename Hasher, typename Password, typename Salt> constexpr void pbkdf2(std::span<std::byte> output, const Password & password, const Salt & salt, size_t iterations) noexcept {
+	constexpr size_t digest_length = Hasher::result_t::digest_length;
+	constexpr size_t lanes = internal::pbkdf2_default_lanes<Hasher>;
+
+	const auto padded_key = internal::hmac_padded_key<Hasher>(internal::byte_span_of(password));
+
+	const auto job_for = [&](size_t block) {
+		const auto part = output.subspan(block * digest_length);
+		return internal::pbkdf2_job<Hasher>{&padded_key, static_cast<uint32_t>(block + 1u), part.first(std::min(part.size(), digest_length))};
+	};
+
+	const size_t blocks = (output.size() + digest_length - 1u) / digest_length;
+	size_t block = 0;
+
+	if constexpr (lanes > 1u) {
+		for (; (blocks - block) >= lanes; block += lanes) {
+			std::array<internal::pbkdf2_job<Hasher>, lanes> jobs;
+			for (size_t l = 0; l != lanes; ++l) {
+				jobs[l] = job_for(block + l);
+			}
+			internal::pbkdf2_run(jobs, salt, iterations);
+		}
+	}
+
+	for (; block != blocks; ++block) {
+		internal::pbkdf2_run(std::array{job_for(block)}, salt, iterations);
+	}
+}
+
+template <typename Hasher, size_t N = Hasher::result_t::digest_length, typename Password, typename Salt> constexpr auto pbkdf2(const Password & password, const Salt & salt, size_t iterations) noexcept -> hash_value<N> {
+	hash_value<N> output;
+	pbkdf2<Hasher>(std::span<std::byte>(output), password, salt, iterations);
+	return output;
+}
+
+// multiple passwords with same salt in parallel lanes (one lane per password)
+template <typename Hasher, size_t N = Hasher::result_t::digest_length, typename Password, size_t Lanes, typename Salt> constexpr auto pbkdf2_batch(const std::array<Password, Lanes> & passwords, const Salt & salt, size_t iterations) noexcept -> std::array<hash_value<N>, Lanes> {
+	constexpr size_t digest_length = Hasher::result_t::digest_length;
+
+	std::array<std::array<std::byte, Hasher::block_size_bytes>, Lanes> padded_keys;
+	for (size_t l = 0; l != Lanes; ++l) {
+		padded_keys[l] = internal::hmac_padded_key<Hasher>(internal::byte_span_of(passwords[l]));
+	}
+
+	std::array<hash_value<N>, Lanes> output;
+
+	for (size_t offset = 0; offset < N; offset += digest_length) {
+		std::array<internal::pbkdf2_job<Hasher>, Lanes> jobs;
+		for (size_t l = 0; l != Lanes; ++l) {
+			const auto part = std::span<std::byte>(output[l]).subspan(offset);
+			jobs[l] = internal::pbkdf2_job<Hasher>{&padded_keys[l], static_cast<uint32_t>(offset / digest_length + 1u), part.first(std::min(part.size(), digest_length))};
+		}
+		internal::pbkdf2_run(jobs, salt, iterations);
+	}
+
+	return output;
+}
+
+} // namespace cthash
+
+#endif
@@ -21,6 +21,37 @@ template <typename Config, typename StageT, size_t StageLength, typename StateT,
 [[gnu::always_inline]] constexpr void rounds(std::span<const StageT, StageLength> w, std::array<StateT, StateLength> & state) noexcept {
 	using state_t = std::array<StateT, StateLength>;
 
+	// during constant evaluation every call and iterator step counts, so variables are renamed instead of rotated
+	if consteval {
+		StateT a = state[0], b = state[1], c = state[2], d = state[3], e = state[4], f = state[5], g = state[6], h = state[7];
+		const StageT * ws = w.data();
+		const StageT * ks = Config::constants.data();
+
+		for (size_t i = 0; i != StageLength; ++i) {
+			const StateT temp1 = h + Config::sum_e(e) + ((e & f) ^ (~e & g)) + ks[i] + ws[i];
+			const StateT temp2 = Config::sum_a(a) + ((a & b) ^ (a & c) ^ (b & c));
+
+			h = g;
+			g = f;
+			f = e;
+			e = d + temp1;
+			d = c;
+			c = b;
+			b = a;
+			a = temp1 + temp2;
+		}
+
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+		state[4] += e;
+		state[5] += f;
+		state[6] += g;
+		state[7] += h;
+		return;
+	}
+
 	// create copy of internal state
 	auto wvar = state_t(state);
 
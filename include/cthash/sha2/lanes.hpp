@@ -0,0 +1,125 @@
+#ifndef CTHASH_SHA2_LANES_HPP
+#define CTHASH_SHA2_LANES_HPP
+
+#include "common.hpp"
+#include "../hasher.hpp"
+#include <algorithm>
+#include <array>
+#include <span>
+#include <cstddef>
+
+namespace cthash::sha2 {
+
+// `Lanes` independent SHA-2 computations in structure-of-arrays layout, every step is done for all lanes at once
+// so compiler can keep each word of all lanes in one vector register
+template <typename Config, size_t Lanes> struct lanes {
+	using hasher_t = internal_hasher<Config>;
+	using item_t = typename hasher_t::state_item_t;
+	using lane_t = std::array<item_t, Lanes>;
+
+	static constexpr size_t state_words = Config::initial_values.size();
+	static constexpr size_t block_words = hasher_t::block_size_bytes / sizeof(item_t);
+
+	using state_t = std::array<lane_t, state_words>;
+	using block_t = std::array<lane_t, block_words>;
+
+	static constexpr auto broadcast(item_t value) noexcept -> lane_t {
+		lane_t output;
+		output.fill(value);
+		return output;
+	}
+
+	static constexpr auto initial_state() noexcept -> state_t {
+		state_t output;
+		for (size_t i = 0; i != state_words; ++i) {
+			output[i] = broadcast(Config::initial_values[i]);
+		}
+		return output;
+	}
+
+	// same block in all lanes (constant padding)
+	static constexpr auto broadcast(const typename hasher_t::block_value_t & block) noexcept -> block_t {
+		block_t output;
+		for (size_t i = 0; i != block_words; ++i) {
+			output[i] = broadcast(cast_from_bytes<item_t>(std::span<const std::byte, sizeof(item_t)>(block.data() + i * sizeof(item_t), sizeof(item_t))));
+		}
+		return output;
+	}
+
+	template <byte_like Byte> static constexpr void load_block(block_t & out, size_t lane, std::span<const Byte, hasher_t::block_size_bytes> in) noexcept {
+		for (size_t i = 0; i != block_words; ++i) {
+			out[i][lane] = cast_from_bytes<item_t>(in.subspan(i * sizeof(item_t)).template first<sizeof(item_t)>());
+		}
+	}
+
+	static constexpr void store_digest(const state_t & state, size_t lane, typename hasher_t::digest_span_t out) noexcept {
+		hasher_t h{};
+		for (size_t i = 0; i != state_words; ++i) {
+			h.hash[i] = state[i][lane];
+		}
+		h.write_result_into(out);
+	}
+
+	using schedule_t = std::array<lane_t, Config::constants.size()>;
+
+	// message schedule from word `first` (words before it are already known)
+	[[gnu::always_inline]] static constexpr void expand(schedule_t & w, size_t first = block_words) noexcept {
+		for (size_t i = first; i != w.size(); ++i) {
+			for (size_t l = 0; l != Lanes; ++l) {
+				w[i][l] = w[i - 16u][l] + Config::sigma_0(w[i - 15u][l]) + w[i - 7u][l] + Config::sigma_1(w[i - 2u][l]);
+			}
+		}
+	}
+
+	// rounds [first, last) over working variables (without final addition), so constant rounds can be skipped
+	[[gnu::always_inline]] static constexpr void rounds(const schedule_t & w, state_t & working, size_t first = 0u, size_t last = Config::constants.size()) noexcept {
+		auto [a, b, c, d, e, f, g, h] = working;
+
+		for (size_t i = first; i != last; ++i) {
+			lane_t temp1;
+			lane_t temp2;
+
+			for (size_t l = 0; l != Lanes; ++l) {
+				temp1[l] = h[l] + Config::sum_e(e[l]) + choice(e[l], f[l], g[l]) + Config::constants[i] + w[i][l];
+				temp2[l] = Config::sum_a(a[l]) + majority(a[l], b[l], c[l]);
+			}
+
+			h = g;
+			g = f;
+			f = e;
+			for (size_t l = 0; l != Lanes; ++l) {
+				e[l] = d[l] + temp1[l];
+			}
+			d = c;
+			c = b;
+			b = a;
+			for (size_t l = 0; l != Lanes; ++l) {
+				a[l] = temp1[l] + temp2[l];
+			}
+		}
+
+		working = state_t{a, b, c, d, e, f, g, h};
+	}
+
+	[[gnu::always_inline]] static constexpr void add(state_t & state, const state_t & working) noexcept {
+		for (size_t i = 0; i != state_words; ++i) {
+			for (size_t l = 0; l != Lanes; ++l) {
+				state[i][l] += working[i][l];
+			}
+		}
+	}
+
+	[[gnu::always_inline]] static constexpr void compress(const block_t & block, state_t & state) noexcept {
+		schedule_t w;
+		std::copy(block.begin(), block.end(), w.begin());
+		expand(w);
+
+		state_t working = state;
+		rounds(w, working);
+		add(state, working);
+	}
+};
+
+} // namespace cthash::sha2
+
+#endif
@@ -0,0 +1,188 @@
+#ifndef CTHASH_SHA2_SHA256D_HPP
+#define CTHASH_SHA2_SHA256D_HPP
+
+#include "lanes.hpp"
+#include "sha256.hpp"
+#include "../hash-fixed.hpp"
+#include "../value.hpp"
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <span>
+#include <cassert>
+#include <cstdint>
+
+namespace cthash {
+
+// SHA-256(SHA-256(input)), second pass is always over 32 bytes so its padding is a constant
+struct sha256d: sha256 {
+	using super = sha256;
+	using result_t = sha256_value;
+	using digest_span_t = typename super::digest_span_t;
+
+	constexpr sha256d() noexcept: super() { }
+	constexpr sha256d(const sha256d &) noexcept = default;
+	constexpr sha256d(sha256d &&) noexcept = default;
+	constexpr sha256d & operator=(const sha256d &) noexcept = default;
+	constexpr sha256d & operator=(sha256d &&) noexcept = default;
+	constexpr ~sha256d() noexcept = default;
+
+	template <typename T> constexpr sha256d & update(const T & in) noexcept {
+		super::update(in);
+		return *this;
+	}
+
+	constexpr sha256d & update(std::span<const std::byte> in) noexcept {
+		super::update(in);
+		return *this;
+	}
+
+	constexpr void final(digest_span_t digest) noexcept {
+		const auto second = hash_fixed<sha256>(super::final());
+		std::copy(second.begin(), second.end(), digest.begin());
+	}
+
+	constexpr result_t final() noexcept {
+		result_t output;
+		this->final(output);
+		return output;
+	}
+
+	constexpr sha256d & reset() noexcept {
+		super::reset();
+		return *this;
+	}
+
+	constexpr void hash_into(digest_span_t digest) noexcept {
+		this->final(digest);
+		reset();
+	}
+};
+
+// half-open range of nonces [first, last), `last` can be 2^32 to include the biggest nonce
+struct nonce_range {
+	uint32_t first;
+	uint64_t last;
+};
+
+namespace internal {
+
+	// 80 byte block header: first block is same for all nonces, second block is last 4 bytes of merkle root, time, bits
+	// and nonce (word 3) followed by constant padding, so everything before nonce is used is calculated only once
+	template <size_t Lanes> struct sha256d_header_lanes {
+		using lanes_t = sha2::lanes<sha256_config, Lanes>;
+		using single_t = sha2::lanes<sha256_config, 1u>;
+		using state_t = typename lanes_t::state_t;
+		using schedule_t = typename lanes_t::schedule_t;
+
+		static constexpr size_t header_size = 80u;
+		static constexpr size_t nonce_word = 3u;
+
+		// W16 and W17 don't depend on W3, W18 is first one which does
+		static constexpr size_t known_schedule = 18u;
+
+		state_t midstate;
+		state_t precomputed;
+		schedule_t schedule{};
+
+		explicit constexpr sha256d_header_lanes(std::span<const std::byte, header_size> header) noexcept {
+			using hashing = fixed_size_hashing<sha256, header_size>;
+
+			typename single_t::block_t block;
+			single_t::load_block(block, 0u, header.first<64>());
+
+			auto first = single_t::initial_state();
+			single_t::compress(block, first);
+
+			auto tail = hashing::tail_block;
+			std::copy(header.begin() + 64, header.end(), tail.begin());
+			single_t::load_block(block, 0u, std::span<const std::byte, 64>(tail));
+
+			typename single_t::schedule_t w;
+			std::copy(block.begin(), block.end(), w.begin());
+			single_t::expand(w);
+
+			auto working = first;
+			single_t::rounds(w, working, 0u, nonce_word);
+
+			for (size_t i = 0; i != lanes_t::state_words; ++i) {
+				midstate[i] = lanes_t::broadcast(first[i][0]);
+				precomputed[i] = lanes_t::broadcast(working[i][0]);
+			}
+
+			for (size_t i = 0; i != known_schedule; ++i) {
+				schedule[i] = lanes_t::broadcast(w[i][0]);
+			}
+		}
+
+		// final state of SHA-256d for nonces `first + lane`
+		constexpr auto calculate(uint32_t first) const noexcept -> state_t {
+			schedule_t w = schedule;
+			for (size_t l = 0; l != Lanes; ++l) {
+				// nonce is stored as little-endian number
+				w[nonce_word][l] = byteswap(static_cast<uint32_t>(first + l));
+			}
+			lanes_t::expand(w, known_schedule);
+
+			state_t working = precomputed;
+			lanes_t::rounds(w, working, nonce_word);
+
+			state_t digest = midstate;
+			lanes_t::add(digest, working);
+
+			// second pass over digest of the first one
+			auto block = lanes_t::broadcast(fixed_size_hashing<sha256, 32u>::tail_block);
+			std::copy(digest.begin(), digest.end(), block.begin());
+
+			state_t output = lanes_t::initial_state();
+			lanes_t::compress(block, output);
+			return output;
+		}
+	};
+
+	// digest is compared as a little-endian 256 bit number (same as in bitcoin), word 7 is the most significant one
+	template <size_t Lanes> constexpr bool not_above_target(const typename sha256d_header_lanes<Lanes>::state_t & state, size_t lane, const std::array<uint32_t, 8> & target) noexcept {
+		for (size_t i = target.size(); i != 0u; --i) {
+			const uint32_t value = byteswap(state[i - 1u][lane]);
+			if (value != target[i - 1u]) {
+				return value < target[i - 1u];
+			}
+		}
+		return true;
+	}
+
+} // namespace internal
+
+// finds first nonce in range for which SHA-256d of the header (with the nonce in last 4 bytes) is not above target,
+// target is in the same byte order as the digest (little-endian), `Lanes` nonces are evaluated at once
+template <size_t Lanes = internal::default_lanes_of<sha256>> constexpr auto sha256d_header_sweep(std::span<const std::byte, 80> header, nonce_range range, const hash_value<32> & target) noexcept -> std::optional<uint32_t> {
+	assert(range.last <= (uint64_t{1u} << 32u));
+
+	const auto sweep = internal::sha256d_header_lanes<Lanes>{header};
+
+	std::array<uint32_t, 8> target_words;
+	for (size_t i = 0; i != target_words.size(); ++i) {
+		target_words[i] = cast_from_le_bytes<uint32_t>(std::span<const std::byte, 4>(target.data() + i * 4u, 4u));
+	}
+
+	for (uint64_t nonce = range.first; nonce < range.last; nonce += Lanes) {
+		const auto state = sweep.calculate(static_cast<uint32_t>(nonce));
+		const size_t used = static_cast<size_t>(std::min<uint64_t>(Lanes, range.last - nonce));
+
+		for (size_t l = 0; l != used; ++l) {
+			if (internal::not_above_target<Lanes>(state, l, target_words)) {
+				return static_cast<uint32_t>(nonce + l);
+			}
+		}
+	}
+
+	return std::nullopt;
+}
+
+template <size_t Lanes = internal::default_lanes_of<sha256>> constexpr auto sha256d_header_sweep(const std::array<std::byte, 80> & header, nonce_range range, const hash_value<32> & target) noexcept -> std::optional<uint32_t> {
+	return sha256d_header_sweep<Lanes>(std::span<const std::byte, 80>(header), range, target);
+}
+
+} // namespace cthash
+
+#endif
@@ -2,12 +2,17 @@
 #define CTHASH_SHA3_COMMON_HPP
 
 #include "keccak-base.hpp"
+#include "xof.hpp"
 #include "../hasher.hpp"
 #include "../internal/bit.hpp"
 #include "../internal/convert.hpp"
+#include "../midstate.hpp"
 #include "../simple.hpp"
 #include "../value.hpp"
+#include <bit>
+#include <optional>
 #include <cstdint>
+#include <cstring>
 
 namespace cthash {
 
@@ -52,6 +57,7 @@ template <typename Config> struct basic_keccak_hasher {
 	static constexpr size_t digest_length = Config::digest_length_bit / 8u;
 	static constexpr size_t rate = Config::rate_bit / 8u;
 	static constexpr size_t capacity = Config::capacity_bit / 8u;
+	static constexpr size_t rounds = keccak::rounds_of<Config>;
 
 	using result_t = cthash::tagged_hash_value<Config>;
 	using digest_span_t = std::span<std::byte, digest_length>;
@@ -59,8 +65,17 @@ template <typename Config> struct basic_keccak_hasher {
 	keccak::state_1600 internal_state{};
 	uint8_t position{0u};
 
-	constexpr basic_keccak_hasher() noexcept {
-		std::fill(internal_state.begin(), internal_state.end(), uint64_t{0});
+	// Keccak-p[1600, rounds]
+	[[gnu::always_inline]] constexpr void permute() noexcept {
+		keccak::keccak_p<rounds>(internal_state);
+	}
+
+	// state is already zeroed by member initializer
+	constexpr basic_keccak_hasher() noexcept = default;
+
+	constexpr void reset() noexcept {
+		internal_state = keccak::state_1600{};
+		position = 0u;
 	}
 
 	template <byte_like T> constexpr size_t xor_overwrite_block(std::span<const T> input) noexcept {
@@ -106,6 +121,30 @@ template <typename Config> struct basic_keccak_hasher {
 		}
 	}
 
+	// whole block is xored word by word (unaligned little-endian loads), loop is unrolled for each rate
+	template <byte_like T> [[gnu::always_inline]] constexpr void absorb_block(std::span<const T, rate> block) noexcept {
+		using value_t = keccak::state_1600::value_type;
+		static_assert((rate % sizeof(value_t)) == 0u);
+		assert(position == 0u);
+
+		// word by word without helper lambdas and spans (each of them costs evaluation steps)
+		if consteval {
+			const T * in = block.data();
+			for (size_t i = 0; i != rate / sizeof(value_t); ++i, in += sizeof(value_t)) {
+				value_t v = 0u;
+				for (size_t j = sizeof(value_t); j != 0u; --j) {
+					v = (v << 8u) | static_cast<uint8_t>(in[j - 1u]);
+				}
+				internal_state[i] ^= v;
+			}
+			return;
+		}
+
+		[&]<size_t... Idx>(std::index_sequence<Idx...>) {
+			((internal_state[Idx] ^= cast_from_le_bytes<value_t>(block.template subspan<Idx * sizeof(value_t), sizeof(value_t)>())), ...);
+		}(std::make_index_sequence<rate / sizeof(value_t)>());
+	}
+
 	template <byte_like T> constexpr auto update(std::span<const T> input) noexcept {
 		assert(position < rate);
 		const size_t remaining_in_buffer = rate - position;
@@ -118,21 +157,21 @@ template <typename Config> struct basic_keccak_hasher {
 		}
 
 		// finish block and call keccak :)
-		const auto first_part = input.first(remaining_in_buffer);
-		input = input.subspan(remaining_in_buffer);
-		xor_overwrite_block(first_part);
-		assert(position == rate);
-		keccak_f(internal_state);
-		position = 0u;
+		if (position != 0u) {
+			const auto first_part = input.first(remaining_in_buffer);
+			input = input.subspan(remaining_in_buffer);
+			xor_overwrite_block(first_part);
+			assert(position == rate);
+			permute();
+			position = 0u;
+		}
 
 		// for each full block we can absorb directly
 		while (input.size() >= rate) {
 			const auto block = input.template first<rate>();
 			input = input.subspan(rate);
-			assert(position == 0u);
-			xor_overwrite_block<T>(block);
-			keccak_f(internal_state);
-			position = 0u;
+			absorb_block<T>(block);
+			permute();
 		}
 
 		// xor overwrite internal state with current remainder, and set position to end of it
@@ -156,13 +195,27 @@ template <typename Config> struct basic_keccak_hasher {
 
 	constexpr void final_absorb() noexcept {
 		xor_padding_block();
-		keccak_f(internal_state);
+		permute();
 	}
 
 	// get resulting hash
 	constexpr void squeeze(std::span<std::byte> output) noexcept {
 		using value_t = keccak::state_1600::value_type;
 
+		// on little-endian hosts the state is already in output byte order, so whole blocks are copied at once
+		if !consteval {
+			if constexpr (std::endian::native == std::endian::little) {
+				while (output.size() > rate) {
+					std::memcpy(output.data(), internal_state.data(), rate);
+					output = output.subspan(rate);
+					permute();
+				}
+
+				std::memcpy(output.data(), internal_state.data(), output.size());
+				return;
+			}
+		}
+
 		static_assert((rate % sizeof(value_t)) == 0u);
 		auto r = std::span<const value_t>(internal_state).first(rate / sizeof(value_t));
 
@@ -170,7 +223,7 @@ template <typename Config> struct basic_keccak_hasher {
 		while ((output.size() >= sizeof(value_t))) {
 			// if we ran out of `rate` part, we need to squeeze another block
 			if (r.empty()) {
-				keccak_f(internal_state);
+				permute();
 				r = std::span<const value_t>(internal_state).first(rate / sizeof(value_t));
 			}
 
@@ -190,7 +243,7 @@ template <typename Config> struct basic_keccak_hasher {
 		if (!output.empty()) {
 			// if we ran out of `rate` part, we need to squeeze another block
 			if (r.empty()) {
-				keccak_f(internal_state);
+				permute();
 				r = std::span<const value_t>(internal_state).first(rate / sizeof(value_t));
 			}
 
@@ -207,9 +260,15 @@ template <typename Config> struct basic_keccak_hasher {
 	constexpr void squeeze(digest_span_t output_fixed) noexcept
 		requires((digest_length < rate) && digest_length != 0u)
 	{
-		auto output = std::span<std::byte>(output_fixed);
-
 		// we don't need to squeeze anything
+		if !consteval {
+			if constexpr (std::endian::native == std::endian::little) {
+				std::memcpy(output_fixed.data(), internal_state.data(), digest_length);
+				return;
+			}
+		}
+
+		auto output = std::span<std::byte>(output_fixed);
 		using value_t = keccak::state_1600::value_type;
 
 		static_assert((rate % sizeof(value_t)) == 0u);
@@ -270,6 +329,61 @@ template <typename Config> struct basic_keccak_hasher {
 		squeeze(output);
 		return output;
 	}
+
+	// output of any length, which can be read incrementally
+	constexpr auto finalize_xof() noexcept -> xof_reader<Config>
+		requires(digest_length == 0u)
+	{
+		final_absorb();
+		return xof_reader<Config>{internal_state};
+	}
+
+	// state export (see midstate.hpp for the format), only absorbing state can be exported
+	static constexpr size_t exported_state_size = hasher_state_header::size + sizeof(keccak::state_1600) + 2u * sizeof(uint32_t);
+
+	static constexpr auto state_header() noexcept -> hasher_state_header {
+		hasher_state_header output{};
+		output.family = hasher_state_header::keccak_family;
+		output.digest_length = static_cast<uint32_t>(digest_length);
+		output.block_size = static_cast<uint32_t>(rate);
+		output.variant = static_cast<uint32_t>(Config::suffix.values[0] | (std::byte{0b0000'0001u} << Config::suffix.bits)) | (rounds != keccak::rc.size() ? static_cast<uint32_t>(rounds << 8u) : 0u);
+		return output;
+	}
+
+	constexpr void export_state_into(std::span<std::byte, exported_state_size> out) const noexcept {
+		state_header().write_into(out.template first<hasher_state_header::size>());
+		auto it = out.subspan(hasher_state_header::size);
+
+		for (uint64_t lane: internal_state) {
+			unwrap_littleendian_number<uint64_t>{it.template first<sizeof(uint64_t)>()} = lane;
+			it = it.subspan(sizeof(uint64_t));
+		}
+
+		unwrap_littleendian_number<uint32_t>{it.template first<sizeof(uint32_t)>()} = position;
+		unwrap_littleendian_number<uint32_t>{it.template last<sizeof(uint32_t)>()} = 0u;
+	}
+
+	// state is modified only if input is valid
+	constexpr bool import_state_from(std::span<const std::byte> in) noexcept {
+		if (in.size() != exported_state_size || hasher_state_header::read_from(in) != state_header()) {
+			return false;
+		}
+
+		auto it = in.subspan(hasher_state_header::size);
+		const auto lanes = it.template first<sizeof(keccak::state_1600)>();
+		const auto pos = cast_from_le_bytes<uint32_t>(it.subspan(sizeof(keccak::state_1600)).template first<sizeof(uint32_t)>());
+
+		if (pos >= rate) {
+			return false;
+		}
+
+		for (size_t i = 0; i != internal_state.size(); ++i) {
+			internal_state[i] = cast_from_le_bytes<uint64_t>(lanes.subspan(i * sizeof(uint64_t)).template first<sizeof(uint64_t)>());
+		}
+
+		position = static_cast<uint8_t>(pos);
+		return true;
+	}
 };
 
 template <typename Config> struct keccak_hasher: basic_keccak_hasher<Config> {
@@ -277,9 +391,14 @@ template <typename Config> struct keccak_hasher: basic_keccak_hasher<Config> {
 	using result_t = typename super::result_t;
 	using digest_span_t = typename super::digest_span_t;
 
+	// rate is used as block size (for HMAC)
+	static constexpr size_t block_size_bytes = super::rate;
+
 	constexpr keccak_hasher() noexcept: super() { }
 	constexpr keccak_hasher(const keccak_hasher &) noexcept = default;
 	constexpr keccak_hasher(keccak_hasher &&) noexcept = default;
+	constexpr keccak_hasher & operator=(const keccak_hasher &) noexcept = default;
+	constexpr keccak_hasher & operator=(keccak_hasher &&) noexcept = default;
 	constexpr ~keccak_hasher() noexcept = default;
 
 	constexpr keccak_hasher & update(std::span<const std::byte> input) noexcept {
@@ -303,9 +422,61 @@ template <typename Config> struct keccak_hasher: basic_keccak_hasher<Config> {
 		return *this;
 	}
 
-	// TODO: any range with value convertible to byte
+	// fragments are absorbed one by one directly into the state
+	template <byte_span_fragments T> constexpr keccak_hasher & update(const T & fragments) noexcept {
+		for (const auto & fragment: fragments) {
+			super::update(fragment_bytes(fragment));
+		}
+		return *this;
+	}
+
+	// input is gathered by blocks and then absorbed
+	template <byte_input_range R> constexpr keccak_hasher & update(R && range) noexcept {
+		std::array<std::byte, super::rate> chunk;
+		auto it = std::ranges::begin(range);
+		const auto end = std::ranges::end(range);
+
+		for (;;) {
+			const size_t copied = byte_copy_some(it, end, chunk);
+			super::update(std::span<const std::byte>(chunk).first(copied));
+
+			if (copied != chunk.size()) {
+				return *this;
+			}
+		}
+	}
 
 	using super::final;
+
+	// final and reset, so the hasher can be reused for another message
+	constexpr void hash_into(digest_span_t digest) noexcept
+		requires(super::digest_length != 0u)
+	{
+		super::final(digest);
+		super::reset();
+	}
+
+	constexpr keccak_hasher & reset() noexcept {
+		super::reset();
+		return *this;
+	}
+
+	// portable snapshot of state (to checkpoint or to share a midstate)
+	using super::exported_state_size;
+
+	constexpr auto export_state() const noexcept -> std::array<std::byte, exported_state_size> {
+		std::array<std::byte, exported_state_size> output;
+		super::export_state_into(output);
+		return output;
+	}
+
+	static constexpr auto import_state(std::span<const std::byte> in) noexcept -> std::optional<keccak_hasher> {
+		keccak_hasher output{};
+		if (!output.import_state_from(in)) {
+			return std::nullopt;
+		}
+		return output;
+	}
 };
 
 template <size_t DigestBits>
@@ -314,6 +485,8 @@ struct sha_config {
 	static constexpr size_t capacity_bit = DigestBits * 2u;
 	static constexpr size_t rate_bit = 1600u - capacity_bit;
 
+	static constexpr size_t rounds = 24u;
+
 	static constexpr auto suffix = keccak_suffix(2, 0b0000'0010u); // in reverse
 };
 
@@ -0,0 +1,178 @@
+#ifndef CTHASH_SHA3_CSHAKE_HPP
+#define CTHASH_SHA3_CSHAKE_HPP
+
+#include "common.hpp"
+#include "shake128.hpp"
+#include "shake256.hpp"
+#include "../fixed-string.hpp"
+#include <array>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+
+namespace cthash {
+
+namespace internal {
+
+	// integer encodings from NIST SP 800-185 (section 2.3.1): big-endian bytes without leading zeros (at least one)
+	// with their count before (left_encode) or after (right_encode) them
+	struct encoded_integer {
+		std::array<std::byte, 9> buffer{};
+		size_t length{0u};
+
+		constexpr auto bytes() const noexcept -> std::span<const std::byte> {
+			return std::span<const std::byte>(buffer).first(length);
+		}
+	};
+
+	constexpr auto encoded_integer_digits(uint64_t value) noexcept -> size_t {
+		size_t n = 1u;
+		while (n < sizeof(uint64_t) && (value >> (n * 8u)) != 0u) {
+			++n;
+		}
+		return n;
+	}
+
+	constexpr auto left_encode(uint64_t value) noexcept -> encoded_integer {
+		const size_t n = encoded_integer_digits(value);
+		encoded_integer output{};
+		output.buffer[0] = static_cast<std::byte>(n);
+		for (size_t i = 0; i != n; ++i) {
+			output.buffer[1u + i] = static_cast<std::byte>(value >> ((n - 1u - i) * 8u));
+		}
+		output.length = n + 1u;
+		return output;
+	}
+
+	constexpr auto right_encode(uint64_t value) noexcept -> encoded_integer {
+		const size_t n = encoded_integer_digits(value);
+		encoded_integer output{};
+		for (size_t i = 0; i != n; ++i) {
+			output.buffer[i] = static_cast<std::byte>(value >> ((n - 1u - i) * 8u));
+		}
+		output.buffer[n] = static_cast<std::byte>(n);
+		output.length = n + 1u;
+		return output;
+	}
+
+	// encode_string(S) = left_encode(bit length of S) || S
+	template <typename Hasher, byte_like T> constexpr void absorb_encoded_string(Hasher & h, std::span<const T> in) noexcept {
+		h.update(left_encode(static_cast<uint64_t>(in.size()) * 8u).bytes());
+		h.update(in);
+	}
+
+	// bytepad(X, rate) ends with zeros up to end of the block, xoring zeros changes nothing so only the permutation is done
+	template <typename Config> constexpr void absorb_zero_padding(basic_keccak_hasher<Config> & h) noexcept {
+		if (h.position != 0u) {
+			h.permute();
+			h.position = 0u;
+		}
+	}
+
+	template <size_t Bits> struct shake_config_of;
+	template <> struct shake_config_of<128u> {
+		using type = shake128_config;
+	};
+	template <> struct shake_config_of<256u> {
+		using type = shake256_config;
+	};
+
+} // namespace internal
+
+// cSHAKE with non-empty function name or customization (same rate as SHAKE, but with domain bits 00)
+template <size_t Bits> struct cshake_config {
+	static_assert(Bits == 128u || Bits == 256u, "Only cSHAKE128 and cSHAKE256 are defined");
+
+	template <size_t N> using variable_digest = tagged_hash_value<variable_bit_length_tag<N, cshake_config>>;
+
+	static constexpr size_t digest_length_bit = 0;
+
+	static constexpr size_t capacity_bit = Bits * 2u;
+	static constexpr size_t rate_bit = 1600u - capacity_bit;
+
+	static constexpr size_t rounds = 24u;
+
+	static constexpr auto suffix = keccak_suffix(2, 0b0000'0000u); // in reverse
+};
+
+namespace internal {
+
+	// when both strings are empty, cSHAKE is defined to be plain SHAKE
+	template <size_t Bits, bool Plain> using cshake_base = keccak_hasher<std::conditional_t<Plain, typename shake_config_of<Bits>::type, cshake_config<Bits>>>;
+
+} // namespace internal
+
+// cSHAKE128/256 (NIST SP 800-185, section 3), bytepad(encode_string(N) || encode_string(S), rate) is absorbed during compilation,
+// customization (S) goes first as function names (N) are reserved for NIST defined functions (KMAC, TupleHash, ...)
+template <size_t Bits, fixed_string Customization = "", fixed_string FunctionName = ""> struct cshake: internal::cshake_base<Bits, (Customization.size() == 0u && FunctionName.size() == 0u)> {
+	using super = internal::cshake_base<Bits, (Customization.size() == 0u && FunctionName.size() == 0u)>;
+	using result_t = typename super::result_t;
+
+	static constexpr auto customization = Customization;
+	static constexpr auto function_name = FunctionName;
+
+	static constexpr super midstate = [] {
+		super h{};
+		if constexpr (Customization.size() != 0u || FunctionName.size() != 0u) {
+			h.update(internal::left_encode(super::rate).bytes());
+			internal::absorb_encoded_string(h, std::span<const typename decltype(FunctionName)::value_type>(FunctionName));
+			internal::absorb_encoded_string(h, std::span<const typename decltype(Customization)::value_type>(Customization));
+			internal::absorb_zero_padding(h);
+		}
+		return h;
+	}();
+
+	constexpr cshake() noexcept: super{midstate} { }
+	constexpr cshake(const cshake &) noexcept = default;
+	constexpr cshake(cshake &&) noexcept = default;
+	constexpr cshake & operator=(const cshake &) noexcept = default;
+	constexpr cshake & operator=(cshake &&) noexcept = default;
+	constexpr ~cshake() noexcept = default;
+
+	template <typename T> constexpr cshake & update(const T & in) noexcept {
+		super::update(in);
+		return *this;
+	}
+
+	constexpr cshake & update(std::span<const std::byte> in) noexcept {
+		super::update(in);
+		return *this;
+	}
+
+	// back to the state after customization
+	constexpr cshake & reset() noexcept {
+		static_cast<super &>(*this) = midstate;
+		return *this;
+	}
+};
+
+template <fixed_string Customization = "", fixed_string FunctionName = ""> using cshake128 = cshake<128u, Customization, FunctionName>;
+template <fixed_string Customization = "", fixed_string FunctionName = ""> using cshake256 = cshake<256u, Customization, FunctionName>;
+
+namespace internal {
+
+	// KMAC and TupleHash append right_encode(L) before finalization, XOF variants use L = 0
+	template <size_t N, typename Hasher> constexpr auto final_with_length(Hasher & h) noexcept {
+		static_assert(N % 8u == 0u, "Only whole bytes are supported!");
+		h.update(right_encode(N).bytes());
+		return h.template final<N>();
+	}
+
+	template <typename Hasher> constexpr void final_with_length(Hasher & h, std::span<std::byte> output) noexcept {
+		h.update(right_encode(static_cast<uint64_t>(output.size()) * 8u).bytes());
+		h.final_absorb();
+		h.squeeze(output);
+	}
+
+	template <typename Hasher> constexpr auto finalize_xof_with_length(Hasher & h) noexcept {
+		h.update(right_encode(0u).bytes());
+		return h.finalize_xof();
+	}
+
+} // namespace internal
+
+} // namespace cthash
+
+#endif
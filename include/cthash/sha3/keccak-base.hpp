@@ -75,14 +75,173 @@ struct state_1600_ref: std::span<uint64_t, (5u * 5u)> {
 	chi_helper(state.subspan<20>().first<5>());
 }
 
-[[gnu::flatten]] constexpr void keccak_f(state_1600 & state) noexcept {
-	// rounds
-	for (int i = 0; i != 24; ++i) {
-		// theta (xor each column together)
+// constant evaluation pays for every call and span access, so here are only plain loops over a local copy of the state
+constexpr void keccak_p_constant_evaluated(state_1600 & state, size_t first_round) noexcept {
+	uint64_t s[25];
+	for (size_t i = 0; i != 25u; ++i) {
+		s[i] = state[i];
+	}
+
+	for (size_t r = first_round; r != rc.size(); ++r) {
+		// theta
+		uint64_t b[5];
+		for (size_t x = 0; x != 5u; ++x) {
+			b[x] = s[x] xor s[x + 5u] xor s[x + 10u] xor s[x + 15u] xor s[x + 20u];
+		}
+		for (size_t x = 0; x != 5u; ++x) {
+			const uint64_t next = b[(x + 1u) % 5u];
+			const uint64_t t = b[(x + 4u) % 5u] xor ((next << 1u) | (next >> 63u));
+			for (size_t y = 0; y != 25u; y += 5u) {
+				s[y + x] ^= t;
+			}
+		}
+
+		// rho and pi
+		uint64_t tmp = s[1];
+		for (size_t i = 0; i != 24u; ++i) {
+			const size_t j = pi[i];
+			const uint64_t next = s[j];
+			s[j] = (tmp << rho[i]) | (tmp >> (64u - rho[i]));
+			tmp = next;
+		}
+
+		// chi
+		for (size_t y = 0; y != 25u; y += 5u) {
+			const uint64_t row[5] = {s[y], s[y + 1u], s[y + 2u], s[y + 3u], s[y + 4u]};
+			for (size_t x = 0; x != 5u; ++x) {
+				s[y + x] = row[x] xor ((~row[(x + 1u) % 5u]) bitand row[(x + 2u) % 5u]);
+			}
+		}
+
+		// iota
+		s[0] ^= rc[r];
+	}
+
+	for (size_t i = 0; i != 25u; ++i) {
+		state[i] = s[i];
+	}
+}
+
+// Keccak-p[1600, Rounds] uses last `Rounds` round constants of Keccak-f[1600] (FIPS 202, section 3.3), all rounds are unrolled
+template <size_t Rounds> [[gnu::flatten]] constexpr void keccak_p(state_1600 & state) noexcept {
+	static_assert(Rounds > 0u && Rounds <= rc.size());
+
+	if consteval {
+		keccak_p_constant_evaluated(state, rc.size() - Rounds);
+		return;
+	}
+
+	[&]<size_t... Idx>(std::index_sequence<Idx...>) {
+		((theta(state), rho_pi(state), chi(state), state[0] ^= rc[rc.size() - Rounds + Idx]), ...);
+	}(std::make_index_sequence<Rounds>());
+}
+
+constexpr void keccak_f(state_1600 & state) noexcept {
+	keccak_p<rc.size()>(state);
+}
+
+// number of rounds used by a hasher config, configs without `rounds` use full Keccak-f[1600]
+template <typename Config> constexpr size_t rounds_of = rc.size();
+template <typename Config>
+	requires requires { Config::rounds; }
+constexpr size_t rounds_of<Config> = Config::rounds;
+
+// multiple independent states in structure-of-arrays layout (each lane of the state holds same lane of all states),
+// so every step of the permutation is done for all states at once and compiler can use vector registers
+template <size_t N> struct state_1600_lanes: std::array<std::array<uint64_t, N>, (5u * 5u)> { };
+
+template <size_t N> [[gnu::always_inline, gnu::flatten]] constexpr void theta(state_1600_lanes<N> & state) noexcept {
+	using lane_t = std::array<uint64_t, N>;
+
+	std::array<lane_t, 5> b;
+	[&]<size_t... X>(std::index_sequence<X...>) {
+		((b[X] = state[X]), ...);
+	}(std::make_index_sequence<5>());
+
+	[&]<size_t... Idx>(std::index_sequence<Idx...>) {
+		(([&] {
+			for (size_t l = 0; l != N; ++l) {
+				b[Idx % 5u][l] ^= state[Idx + 5u][l];
+			}
+		}()),
+			...);
+	}(std::make_index_sequence<20>());
+
+	std::array<lane_t, 5> tmp;
+	[&]<size_t... X>(std::index_sequence<X...>) {
+		(([&] {
+			for (size_t l = 0; l != N; ++l) {
+				tmp[X][l] = b[(X + 4u) % 5u][l] xor std::rotl(b[(X + 1u) % 5u][l], 1);
+			}
+		}()),
+			...);
+	}(std::make_index_sequence<5>());
+
+	[&]<size_t... Idx>(std::index_sequence<Idx...>) {
+		(([&] {
+			for (size_t l = 0; l != N; ++l) {
+				state[Idx][l] ^= tmp[Idx % 5u][l];
+			}
+		}()),
+			...);
+	}(std::make_index_sequence<25>());
+}
+
+template <size_t N> [[gnu::always_inline, gnu::flatten]] constexpr void rho_pi(state_1600_lanes<N> & state) noexcept {
+	std::array<uint64_t, N> tmp = state[1];
+
+	[&]<size_t... Idx>(std::index_sequence<Idx...>) {
+		(([&] {
+			const auto next = state[pi[Idx]];
+			for (size_t l = 0; l != N; ++l) {
+				state[pi[Idx]][l] = std::rotl(tmp[l], rho[Idx]);
+			}
+			tmp = next;
+		}()),
+			...);
+	}(std::make_index_sequence<24>());
+}
+
+template <size_t N> [[gnu::always_inline, gnu::flatten]] constexpr void chi(state_1600_lanes<N> & state) noexcept {
+	for (size_t y = 0; y != 25u; y += 5u) {
+		const std::array<std::array<uint64_t, N>, 5> row{state[y], state[y + 1u], state[y + 2u], state[y + 3u], state[y + 4u]};
+		[&]<size_t... X>(std::index_sequence<X...>) {
+			(([&] {
+				for (size_t l = 0; l != N; ++l) {
+					state[y + X][l] = row[X][l] xor ((~row[(X + 1u) % 5u][l]) bitand row[(X + 2u) % 5u][l]);
+				}
+			}()),
+				...);
+		}(std::make_index_sequence<5>());
+	}
+}
+
+template <size_t Rounds, size_t N> [[gnu::flatten]] constexpr void keccak_p(state_1600_lanes<N> & state) noexcept {
+	static_assert(Rounds > 0u && Rounds <= rc.size());
+
+	for (size_t i = rc.size() - Rounds; i != rc.size(); ++i) {
 		theta(state);
 		rho_pi(state);
 		chi(state);
-		state[0] ^= rc[static_cast<size_t>(i)];
+		for (size_t l = 0; l != N; ++l) {
+			state[0][l] ^= rc[i];
+		}
+	}
+}
+
+template <size_t N> constexpr void keccak_f(state_1600_lanes<N> & state) noexcept {
+	keccak_p<rc.size()>(state);
+}
+
+template <size_t N> constexpr void load_lane(state_1600_lanes<N> & out, size_t lane, const state_1600 & in) noexcept {
+	for (size_t i = 0; i != in.size(); ++i) {
+		out[i][lane] = in[i];
+	}
+}
+
+template <size_t N> constexpr void store_lane(const state_1600_lanes<N> & in, size_t lane, state_1600 & out) noexcept {
+	for (size_t i = 0; i != out.size(); ++i) {
+		out[i] = in[i][lane];
 	}
 }
 
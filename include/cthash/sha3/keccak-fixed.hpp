@@ -0,0 +1,95 @@
+#ifndef CTHASH_SHA3_KECCAK_FIXED_HPP
+#define CTHASH_SHA3_KECCAK_FIXED_HPP
+
+#include "keccak.hpp"
+#include "../hash-fixed.hpp"
+#include "../internal/convert.hpp"
+#include <algorithm>
+#include <array>
+#include <span>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+namespace cthash {
+
+// Keccak-256 of inputs with size known during compilation (eg. 32 byte storage slot keys or 64 byte public keys),
+// whole input is absorbed at once and padding is xored as precomputed lanes
+template <size_t N, byte_like Byte> constexpr auto keccak_256_fixed(std::span<const Byte, N> in) noexcept -> keccak_256_value {
+	return hash_fixed<keccak_256>(in);
+}
+
+template <size_t N, byte_like Byte> constexpr auto keccak_256_fixed(const std::array<Byte, N> & in) noexcept -> keccak_256_value {
+	return hash_fixed<keccak_256>(std::span<const Byte, N>(in));
+}
+
+template <size_t N> constexpr auto keccak_256_fixed(const hash_value<N> & in) noexcept -> keccak_256_value {
+	return hash_fixed<keccak_256>(in);
+}
+
+// batch of inputs of the same size, hashed with multi-state permutation
+template <size_t N, byte_like Byte> constexpr void keccak_256_many(std::span<const std::array<Byte, N>> in, std::span<keccak_256_value> out) noexcept {
+	hash_fixed_many<keccak_256>(in, out);
+}
+
+namespace internal {
+
+	// inputs of any size hashed together, a lane which is already finished is still permuted with others, so it's best
+	// when all inputs have the same number of blocks (size / rate), output of each lane is squeezed into its span (also for XOFs)
+	template <typename Config, size_t Lanes, byte_like Byte> constexpr void keccak_lanes(const std::array<std::span<const Byte>, Lanes> & in, const std::array<std::span<std::byte>, Lanes> & out) noexcept {
+		using hasher_t = basic_keccak_hasher<Config>;
+		using value_t = keccak::state_1600::value_type;
+		constexpr size_t rate = hasher_t::rate;
+
+		const size_t blocks = std::ranges::max(in, {}, [](std::span<const Byte> s) { return s.size(); }).size() / rate + 1u;
+
+		keccak::state_1600_lanes<Lanes> states{};
+
+		for (size_t b = 0; b != blocks; ++b) {
+			for (size_t l = 0; l != Lanes; ++l) {
+				const size_t last = in[l].size() / rate;
+
+				if (b < last) {
+					const auto block = in[l].subspan(b * rate).template first<rate>();
+					for (size_t w = 0; w != rate / sizeof(value_t); ++w) {
+						states[w][l] ^= cast_from_le_bytes<value_t>(block.subspan(w * sizeof(value_t)).template first<sizeof(value_t)>());
+					}
+				} else if (b == last) {
+					// tail with padding is prepared in scalar state and xored in
+					hasher_t h{};
+					h.update(in[l].subspan(b * rate));
+					h.xor_padding_block();
+					for (size_t w = 0; w != h.internal_state.size(); ++w) {
+						states[w][l] ^= h.internal_state[w];
+					}
+				}
+			}
+
+			keccak::keccak_p<hasher_t::rounds>(states);
+
+			for (size_t l = 0; l != Lanes; ++l) {
+				if (b == in[l].size() / rate) {
+					hasher_t h{};
+					keccak::store_lane(states, l, h.internal_state);
+					h.squeeze(out[l]);
+				}
+			}
+		}
+	}
+
+	template <typename Config, size_t Lanes, byte_like Byte> constexpr auto keccak_lanes(const std::array<std::span<const Byte>, Lanes> & in) noexcept -> std::array<typename basic_keccak_hasher<Config>::result_t, Lanes> {
+		std::array<typename basic_keccak_hasher<Config>::result_t, Lanes> output;
+		keccak_lanes<Config>(in, [&]<size_t... Idx>(std::index_sequence<Idx...>) { return std::array{std::span<std::byte>(output[Idx])...}; }(std::make_index_sequence<Lanes>()));
+		return output;
+	}
+
+} // namespace internal
+
+// multiple inputs of different sizes (eg. trie nodes), hashed with multi-state permutation
+template <size_t Lanes, byte_like Byte> constexpr auto keccak_256_lanes(const std::array<std::span<const Byte>, Lanes> & in) noexcept -> std::array<keccak_256_value, Lanes> {
+	return internal::keccak_lanes<prenist_keccak_config<256>>(in);
+}
+
+} // namespace cthash
+
+#endif
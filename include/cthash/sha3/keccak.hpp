@@ -10,6 +10,8 @@ template <unsigned N> struct prenist_keccak_config {
 	static constexpr size_t capacity_bit = digest_length_bit * 2u;
 	static constexpr size_t rate_bit = 1600u - capacity_bit;
 
+	static constexpr size_t rounds = 24u;
+
 	// Keccak (pre-NIST) domain bit = 0x01
 	static constexpr auto suffix = keccak_suffix(0, 0x00);
 };
@@ -0,0 +1,81 @@
+#ifndef CTHASH_SHA3_KMAC_HPP
+#define CTHASH_SHA3_KMAC_HPP
+
+#include "cshake.hpp"
+#include "../internal/concepts.hpp"
+#include <span>
+#include <string_view>
+#include <cstddef>
+
+namespace cthash {
+
+// KMAC128/256 (NIST SP 800-185, section 4): cSHAKE with function name "KMAC" over bytepad(encode_string(K), rate) || X || right_encode(L),
+// the key is absorbed in constructor, so a copy of keyed object can be used for many messages
+template <size_t Bits, fixed_string Customization = ""> struct kmac {
+	using hasher_t = cshake<Bits, Customization, "KMAC">;
+
+	template <size_t N> using result_t = typename cshake_config<Bits>::template variable_digest<N>;
+
+	hasher_t inner{};
+
+	explicit constexpr kmac(std::span<const std::byte> key) noexcept {
+		absorb_key(key);
+	}
+
+	template <convertible_to_byte_span T> explicit constexpr kmac(const T & key) noexcept {
+		using value_type = typename decltype(std::span(key))::value_type;
+		absorb_key(std::span<const value_type>(key));
+	}
+
+	template <one_byte_char CharT> explicit constexpr kmac(std::basic_string_view<CharT> key) noexcept {
+		absorb_key(std::span(key.data(), key.size()));
+	}
+
+	template <string_literal T> explicit constexpr kmac(const T & key) noexcept {
+		absorb_key(std::span(key, std::size(key) - 1u));
+	}
+
+	constexpr kmac(const kmac &) noexcept = default;
+	constexpr kmac(kmac &&) noexcept = default;
+	constexpr kmac & operator=(const kmac &) noexcept = default;
+	constexpr kmac & operator=(kmac &&) noexcept = default;
+	constexpr ~kmac() noexcept = default;
+
+	constexpr kmac & update(std::span<const std::byte> input) noexcept {
+		inner.update(input);
+		return *this;
+	}
+
+	template <typename T> constexpr kmac & update(const T & something) noexcept {
+		inner.update(something);
+		return *this;
+	}
+
+	// output length is part of the MAC, so different lengths give unrelated outputs
+	template <size_t N> constexpr auto final() noexcept -> result_t<N> {
+		return internal::final_with_length<N>(inner);
+	}
+
+	constexpr void final(std::span<std::byte> output) noexcept {
+		internal::final_with_length(inner, output);
+	}
+
+	// KMACXOF (output length is encoded as zero)
+	constexpr auto finalize_xof() noexcept {
+		return internal::finalize_xof_with_length(inner);
+	}
+
+private:
+	template <byte_like T> constexpr void absorb_key(std::span<const T> key) noexcept {
+		inner.update(internal::left_encode(hasher_t::rate).bytes());
+		internal::absorb_encoded_string(inner, key);
+		internal::absorb_zero_padding(inner);
+	}
+};
+
+template <fixed_string Customization = ""> using kmac128 = kmac<128u, Customization>;
+template <fixed_string Customization = ""> using kmac256 = kmac<256u, Customization>;
+
+} // namespace cthash
+
+#endif
@@ -0,0 +1,210 @@
+#ifndef CTHASH_SHA3_PARALLELHASH_HPP
+#define CTHASH_SHA3_PARALLELHASH_HPP
+
+#include "cshake.hpp"
+#include "keccak-fixed.hpp"
+#include "../internal/concepts.hpp"
+#include "../internal/convert.hpp"
+#include "../internal/parallel.hpp"
+#include <algorithm>
+#include <array>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace cthash {
+
+// ParallelHash128/256 (NIST SP 800-185, section 6): input is split into blocks of B bytes, each block is hashed independently
+// with SHAKE into a chaining value, and the chaining values are hashed with cSHAKE (function name "ParallelHash"),
+// blocks are hashed `lanes` at once with multi-state permutation and big inputs can be split across threads
+template <size_t Bits, fixed_string Customization = ""> class parallel_hash {
+public:
+	using hasher_t = cshake<Bits, Customization, "ParallelHash">;
+	using leaf_config = typename internal::shake_config_of<Bits>::type;
+
+	template <size_t N> using result_t = typename cshake_config<Bits>::template variable_digest<N>;
+
+	static constexpr size_t chaining_length = Bits * 2u / 8u;
+	static constexpr size_t lanes = 4u;
+
+	// inputs with fewer blocks than this are not split across threads
+	static constexpr size_t parallel_threshold = 64u;
+
+private:
+	using chaining_value = std::array<std::byte, chaining_length>;
+	using leaf_hasher = basic_keccak_hasher<leaf_config>;
+
+	hasher_t outer{};
+	std::vector<std::byte> pending{};
+	size_t block_size;
+	size_t threads;
+	uint64_t block_count{0u};
+
+	// `in` contains exactly `lanes` blocks of the same size
+	static constexpr auto hash_lanes(std::span<const std::byte> in, size_t block_size) noexcept -> std::array<chaining_value, lanes> {
+		std::array<chaining_value, lanes> output;
+
+		[&]<size_t... Idx>(std::index_sequence<Idx...>) {
+			internal::keccak_lanes<leaf_config>(std::array{in.subspan(Idx * block_size, block_size)...}, std::array{std::span<std::byte>(output[Idx])...});
+		}(std::make_index_sequence<lanes>());
+
+		return output;
+	}
+
+	static constexpr auto hash_block(std::span<const std::byte> in) noexcept -> chaining_value {
+		leaf_hasher h{};
+		h.update(in);
+		h.final_absorb();
+
+		chaining_value output;
+		h.squeeze(output);
+		return output;
+	}
+
+	// chaining values of blocks [first, last) of `in`
+	static constexpr void hash_blocks(std::span<const std::byte> in, size_t block_size, std::span<chaining_value> out, size_t first, size_t last) noexcept {
+		size_t i = first;
+
+		for (; (last - i) >= lanes; i += lanes) {
+			const auto values = hash_lanes(in.subspan(i * block_size, lanes * block_size), block_size);
+			std::copy(values.begin(), values.end(), out.begin() + static_cast<std::ptrdiff_t>(i - first));
+		}
+
+		for (; i != last; ++i) {
+			out[i - first] = hash_block(in.subspan(i * block_size, block_size));
+		}
+	}
+
+	// `in` contains whole blocks only, their chaining values are absorbed in order
+	constexpr void absorb_blocks(std::span<const std::byte> in) {
+		assert(in.size() % block_size == 0u);
+		const size_t count = in.size() / block_size;
+		block_count += count;
+
+		const auto sequential = [&] {
+			std::array<chaining_value, lanes> values;
+			for (size_t i = 0; i < count; i += lanes) {
+				const size_t n = std::min(lanes, count - i);
+				hash_blocks(in.subspan(i * block_size, n * block_size), block_size, std::span<chaining_value>(values).first(n), 0u, n);
+				for (size_t l = 0; l != n; ++l) {
+					outer.update(std::span<const std::byte>(values[l]));
+				}
+			}
+		};
+
+		if consteval {
+			sequential();
+		} else {
+			const size_t parts = std::min(threads, count / parallel_threshold);
+
+			if (parts <= 1u) {
+				sequential();
+				return;
+			}
+
+			std::vector<chaining_value> values(count);
+
+			internal::parallel_for_lanes(count, parts, lanes, [&](size_t first, size_t last) { hash_blocks(in, block_size, std::span<chaining_value>(values).subspan(first, last - first), first, last); });
+
+			for (const chaining_value & v: values) {
+				outer.update(std::span<const std::byte>(v));
+			}
+		}
+	}
+
+	// last (possibly incomplete) block and lengths
+	constexpr void finish(uint64_t output_bits) {
+		const size_t whole = pending.size() / block_size * block_size;
+		absorb_blocks(std::span<const std::byte>(pending).first(whole));
+
+		if (whole != pending.size()) {
+			const auto value = hash_block(std::span<const std::byte>(pending).subspan(whole));
+			outer.update(std::span<const std::byte>(value));
+			++block_count;
+		}
+
+		pending.clear();
+		outer.update(internal::right_encode(block_count).bytes());
+		outer.update(internal::right_encode(output_bits).bytes());
+	}
+
+public:
+	explicit constexpr parallel_hash(size_t block, size_t thread_count = 1u): block_size{block}, threads{thread_count} {
+		assert(block_size != 0u);
+		outer.update(internal::left_encode(block_size).bytes());
+		pending.reserve(lanes * block_size);
+	}
+
+	// input is buffered until `lanes` blocks are available, bigger inputs are hashed directly
+	constexpr parallel_hash & update(std::span<const std::byte> input) {
+		const size_t group = lanes * block_size;
+
+		if (!pending.empty()) {
+			const size_t taken = std::min(input.size(), group - pending.size());
+			pending.insert(pending.end(), input.begin(), input.begin() + static_cast<std::ptrdiff_t>(taken));
+			input = input.subspan(taken);
+
+			if (pending.size() != group) {
+				return *this;
+			}
+
+			absorb_blocks(pending);
+			pending.clear();
+		}
+
+		const size_t direct = input.size() / group * group;
+		absorb_blocks(input.first(direct));
+		pending.assign(input.begin() + static_cast<std::ptrdiff_t>(direct), input.end());
+		return *this;
+	}
+
+	template <convertible_to_byte_span T> constexpr parallel_hash & update(const T & something) {
+		using value_type = typename decltype(std::span(something))::value_type;
+		const auto in = std::span<const value_type>(something);
+
+		if consteval {
+			std::vector<std::byte> tmp(in.size());
+			byte_copy(in.begin(), in.end(), tmp.begin());
+			return update(std::span<const std::byte>(tmp));
+		} else {
+			return update(std::as_bytes(in));
+		}
+	}
+
+	template <one_byte_char CharT> constexpr parallel_hash & update(std::basic_string_view<CharT> in) {
+		return update(std::span(in.data(), in.size()));
+	}
+
+	template <string_literal T> constexpr parallel_hash & update(const T & lit) {
+		return update(std::span(lit, std::size(lit) - 1u));
+	}
+
+	template <size_t N> constexpr auto final() -> result_t<N> {
+		static_assert(N % 8u == 0u, "Only whole bytes are supported!");
+		finish(N);
+		return outer.template final<N>();
+	}
+
+	constexpr void final(std::span<std::byte> output) {
+		finish(static_cast<uint64_t>(output.size()) * 8u);
+		outer.final_absorb();
+		outer.squeeze(output);
+	}
+
+	// ParallelHashXOF (output length is encoded as zero)
+	constexpr auto finalize_xof() {
+		finish(0u);
+		return outer.finalize_xof();
+	}
+};
+
+template <fixed_string Customization = ""> using parallel_hash128 = parallel_hash<128u, Customization>;
+template <fixed_string Customization = ""> using parallel_hash256 = parallel_hash<256u, Customization>;
+
+} // namespace cthash
+
+#endif
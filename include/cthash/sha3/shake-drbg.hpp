@@ -0,0 +1,114 @@
+#ifndef CTHASH_SHA3_SHAKE_DRBG_HPP
+#define CTHASH_SHA3_SHAKE_DRBG_HPP
+
+#include "shake128.hpp"
+#include "shake256.hpp"
+#include "xof.hpp"
+#include "../internal/convert.hpp"
+#include <array>
+#include <concepts>
+#include <limits>
+#include <span>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+namespace cthash {
+
+namespace internal {
+
+	template <size_t Bits> struct shake_of;
+	template <> struct shake_of<128u> {
+		using type = shake128;
+	};
+	template <> struct shake_of<256u> {
+		using type = shake256;
+	};
+
+} // namespace internal
+
+// reproducible stream of random bytes: seed is absorbed into SHAKE and output is squeezed from the XOF (the state
+// itself is the buffer, one rate block is permuted at a time), it's a `std::uniform_random_bit_generator`
+template <size_t Bits> class shake_drbg {
+public:
+	using hasher_t = typename internal::shake_of<Bits>::type;
+	using reader_t = decltype(std::declval<hasher_t &>().finalize_xof());
+	using result_type = uint64_t;
+
+private:
+	reader_t reader;
+
+public:
+	// anything which can be absorbed by SHAKE can be a seed
+	template <typename T> explicit constexpr shake_drbg(const T & seed) noexcept: reader{hasher_t{}.update(seed).finalize_xof()} { }
+	explicit constexpr shake_drbg(const reader_t & r) noexcept: reader{r} { }
+
+	static constexpr auto min() noexcept -> result_type {
+		return std::numeric_limits<result_type>::min();
+	}
+
+	static constexpr auto max() noexcept -> result_type {
+		return std::numeric_limits<result_type>::max();
+	}
+
+	constexpr shake_drbg & generate(std::span<std::byte> output) noexcept {
+		reader.read(output);
+		return *this;
+	}
+
+	// next sizeof(T) bytes as little-endian number
+	template <std::unsigned_integral T> constexpr auto uniform() noexcept -> T {
+		const auto bytes = reader.template read<sizeof(T)>();
+		return cast_from_le_bytes<T>(std::span<const std::byte, sizeof(T)>(bytes));
+	}
+
+	constexpr auto operator()() noexcept -> result_type {
+		return uniform<result_type>();
+	}
+};
+
+using shake128_drbg = shake_drbg<128u>;
+using shake256_drbg = shake_drbg<256u>;
+
+// `Streams` independent generators (stream `i` is seeded with seed || u64 little-endian `i`), output of all of them
+// is squeezed together with multi-state permutation
+template <size_t Bits, size_t Streams = 4u> class shake_drbg_streams {
+public:
+	using hasher_t = typename internal::shake_of<Bits>::type;
+	using reader_t = typename shake_drbg<Bits>::reader_t;
+
+	static constexpr size_t streams = Streams;
+
+private:
+	std::array<reader_t, Streams> readers;
+
+	template <typename T> static constexpr auto make_readers(const T & seed) noexcept -> std::array<reader_t, Streams> {
+		return [&]<size_t... Idx>(std::index_sequence<Idx...>) {
+			return std::array<reader_t, Streams>{make_reader(seed, Idx)...};
+		}(std::make_index_sequence<Streams>());
+	}
+
+	template <typename T> static constexpr auto make_reader(const T & seed, uint64_t index) noexcept -> reader_t {
+		std::array<std::byte, sizeof(uint64_t)> suffix;
+		unwrap_littleendian_number<uint64_t>{suffix} = index;
+		return hasher_t{}.update(seed).update(std::span<const std::byte>(suffix)).finalize_xof();
+	}
+
+public:
+	template <typename T> explicit constexpr shake_drbg_streams(const T & seed) noexcept: readers{make_readers(seed)} { }
+
+	// same amount of bytes from every stream
+	constexpr shake_drbg_streams & generate(const std::array<std::span<std::byte>, Streams> & outputs) noexcept {
+		read_lanes(readers, outputs);
+		return *this;
+	}
+
+	// copy of one of the streams as a standalone generator (from its current position)
+	constexpr auto stream(size_t index) const noexcept -> shake_drbg<Bits> {
+		return shake_drbg<Bits>{readers[index]};
+	}
+};
+
+} // namespace cthash
+
+#endif
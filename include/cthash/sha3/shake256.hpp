@@ -15,6 +15,8 @@ struct shake256_config {
 	static constexpr size_t capacity_bit = 512;
 	static constexpr size_t rate_bit = 1088;
 
+	static constexpr size_t rounds = 24u;
+
 	static constexpr auto suffix = keccak_suffix(4, 0b0000'1111u); // in reverse
 };
 
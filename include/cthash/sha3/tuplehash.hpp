@@ -0,0 +1,62 @@
+#ifndef CTHASH_SHA3_TUPLEHASH_HPP
+#define CTHASH_SHA3_TUPLEHASH_HPP
+
+#include "cshake.hpp"
+#include "../internal/concepts.hpp"
+#include <span>
+#include <string_view>
+#include <cstddef>
+
+namespace cthash {
+
+// TupleHash128/256 (NIST SP 800-185, section 5): every element is absorbed as encode_string(element), so the boundaries
+// between elements are part of the hash ("ab", "c") != ("a", "bc")
+template <size_t Bits, fixed_string Customization = ""> struct tuple_hash {
+	using hasher_t = cshake<Bits, Customization, "TupleHash">;
+
+	template <size_t N> using result_t = typename cshake_config<Bits>::template variable_digest<N>;
+
+	hasher_t inner{};
+
+	// each call adds one whole element of the tuple
+	constexpr tuple_hash & add(std::span<const std::byte> element) noexcept {
+		internal::absorb_encoded_string(inner, element);
+		return *this;
+	}
+
+	template <convertible_to_byte_span T> constexpr tuple_hash & add(const T & element) noexcept {
+		using value_type = typename decltype(std::span(element))::value_type;
+		internal::absorb_encoded_string(inner, std::span<const value_type>(element));
+		return *this;
+	}
+
+	template <one_byte_char CharT> constexpr tuple_hash & add(std::basic_string_view<CharT> element) noexcept {
+		internal::absorb_encoded_string(inner, std::span(element.data(), element.size()));
+		return *this;
+	}
+
+	template <string_literal T> constexpr tuple_hash & add(const T & element) noexcept {
+		internal::absorb_encoded_string(inner, std::span(element, std::size(element) - 1u));
+		return *this;
+	}
+
+	template <size_t N> constexpr auto final() noexcept -> result_t<N> {
+		return internal::final_with_length<N>(inner);
+	}
+
+	constexpr void final(std::span<std::byte> output) noexcept {
+		internal::final_with_length(inner, output);
+	}
+
+	// TupleHashXOF (output length is encoded as zero)
+	constexpr auto finalize_xof() noexcept {
+		return internal::finalize_xof_with_length(inner);
+	}
+};
+
+template <fixed_string Customization = ""> using tuple_hash128 = tuple_hash<128u, Customization>;
+template <fixed_string Customization = ""> using tuple_hash256 = tuple_hash<256u, Customization>;
+
+} // namespace cthash
+
+#endif
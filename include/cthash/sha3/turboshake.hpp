@@ -0,0 +1,33 @@
+#ifndef CTHASH_SHA3_TURBOSHAKE_HPP
+#define CTHASH_SHA3_TURBOSHAKE_HPP
+
+#include "common.hpp"
+#include <bit>
+
+namespace cthash {
+
+// TurboSHAKE128/256 (RFC 9861): SHAKE with Keccak-p[1600, 12] and a domain separation byte (0x01 to 0x7F)
+template <size_t Bits, uint8_t Domain = 0x1Fu> struct turboshake_config {
+	static_assert(Bits == 128u || Bits == 256u, "Only TurboSHAKE128 and TurboSHAKE256 are defined");
+	static_assert(Domain >= 0x01u && Domain <= 0x7Fu, "Domain separation byte must be in range 0x01 to 0x7F");
+
+	template <size_t N> using variable_digest = tagged_hash_value<variable_bit_length_tag<N, turboshake_config>>;
+
+	static constexpr size_t digest_length_bit = 0;
+
+	static constexpr size_t capacity_bit = Bits * 2u;
+	static constexpr size_t rate_bit = 1600u - capacity_bit;
+
+	static constexpr size_t rounds = 12u;
+
+	// domain byte already contains first bit of the padding (its highest set bit)
+	static constexpr unsigned domain_bits = static_cast<unsigned>(std::bit_width(Domain)) - 1u;
+	static constexpr auto suffix = keccak_suffix(domain_bits, Domain ^ (1u << domain_bits));
+};
+
+template <uint8_t Domain = 0x1Fu> using turboshake128 = cthash::keccak_hasher<turboshake_config<128u, Domain>>;
+template <uint8_t Domain = 0x1Fu> using turboshake256 = cthash::keccak_hasher<turboshake_config<256u, Domain>>;
+
+} // namespace cthash
+
+#endif
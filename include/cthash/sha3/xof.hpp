@@ -0,0 +1,125 @@
+#ifndef CTHASH_SHA3_XOF_HPP
+#define CTHASH_SHA3_XOF_HPP
+
+#include "keccak-base.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <span>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace cthash {
+
+// output of extendable-output function (SHAKE), can be read in pieces of any length
+template <typename Config> class xof_reader {
+public:
+	static constexpr size_t rate = Config::rate_bit / 8u;
+	static constexpr size_t rounds = keccak::rounds_of<Config>;
+
+private:
+	keccak::state_1600 internal_state;
+	size_t position{0u}; // bytes already read from current block
+
+	// bytes [from, from + out.size()) of current block
+	constexpr void copy_out(size_t from, std::span<std::byte> out) const noexcept {
+		if consteval {
+			for (size_t i = 0; i != out.size(); ++i) {
+				out[i] = static_cast<std::byte>(internal_state[(from + i) / sizeof(uint64_t)] >> (((from + i) % sizeof(uint64_t)) * 8u));
+			}
+		} else {
+			if constexpr (std::endian::native == std::endian::little) {
+				std::memcpy(out.data(), reinterpret_cast<const std::byte *>(internal_state.data()) + from, out.size());
+			} else {
+				for (size_t i = 0; i != out.size(); ++i) {
+					out[i] = static_cast<std::byte>(internal_state[(from + i) / sizeof(uint64_t)] >> (((from + i) % sizeof(uint64_t)) * 8u));
+				}
+			}
+		}
+	}
+
+	template <typename C, size_t N> friend constexpr void read_lanes(std::array<xof_reader<C>, N> &, const std::array<std::span<std::byte>, N> &) noexcept;
+
+public:
+	// state after absorbing padding and first permutation
+	explicit constexpr xof_reader(const keccak::state_1600 & state) noexcept: internal_state{state} { }
+
+	// number of bytes which can be read without permutation
+	constexpr auto available() const noexcept -> size_t {
+		return rate - position;
+	}
+
+	constexpr xof_reader & read(std::span<std::byte> output) noexcept {
+		// rest of current block
+		const size_t first = std::min(output.size(), available());
+		copy_out(position, output.first(first));
+		position += first;
+		output = output.subspan(first);
+
+		// whole blocks are copied directly
+		while (output.size() >= rate) {
+			keccak::keccak_p<rounds>(internal_state);
+			copy_out(0u, output.template first<rate>());
+			output = output.subspan(rate);
+		}
+
+		if (not output.empty()) {
+			keccak::keccak_p<rounds>(internal_state);
+			copy_out(0u, output);
+			position = output.size();
+		}
+
+		return *this;
+	}
+
+	template <size_t N> constexpr auto read() noexcept -> std::array<std::byte, N> {
+		std::array<std::byte, N> output;
+		read(output);
+		return output;
+	}
+};
+
+// read same amount of output from multiple independent readers (eg. matrix expansion), when all readers are
+// at same position, whole blocks of all of them are calculated together with multi-state permutation
+template <typename Config, size_t N> constexpr void read_lanes(std::array<xof_reader<Config>, N> & readers, const std::array<std::span<std::byte>, N> & outputs) noexcept {
+	constexpr size_t rate = xof_reader<Config>::rate;
+	const size_t length = outputs[0].size();
+
+	const bool same_position = std::ranges::all_of(readers, [&](const xof_reader<Config> & r) { return r.position == readers[0].position; });
+	const bool same_length = std::ranges::all_of(outputs, [&](std::span<std::byte> out) { return out.size() == length; });
+
+	if (!same_position || !same_length || (length - std::min(length, readers[0].available())) < rate) {
+		for (size_t l = 0; l != N; ++l) {
+			readers[l].read(outputs[l]);
+		}
+		return;
+	}
+
+	const size_t first = readers[0].available();
+	const size_t blocks = (length - first) / rate;
+	const size_t last = length - first - blocks * rate;
+
+	keccak::state_1600_lanes<N> states;
+	for (size_t l = 0; l != N; ++l) {
+		readers[l].copy_out(readers[l].position, outputs[l].first(first));
+		keccak::load_lane(states, l, readers[l].internal_state);
+	}
+
+	for (size_t b = 0; b != blocks; ++b) {
+		keccak::keccak_p<xof_reader<Config>::rounds>(states);
+		for (size_t l = 0; l != N; ++l) {
+			keccak::store_lane(states, l, readers[l].internal_state);
+			readers[l].copy_out(0u, outputs[l].subspan(first + b * rate, rate));
+		}
+	}
+
+	for (size_t l = 0; l != N; ++l) {
+		readers[l].position = rate;
+		readers[l].read(outputs[l].last(last));
+	}
+}
+
+} // namespace cthash
+
+#endif
@@ -5,11 +5,14 @@
 #include "encoding/base.hpp"
 #include "encoding/encodings.hpp"
 #include "internal/algorithm.hpp"
+#include "internal/bit.hpp"
+#include "internal/convert.hpp"
 #include "internal/deduce.hpp"
 #include "internal/hexdec.hpp"
 #include <algorithm>
 #include <array>
 #include <format>
+#include <functional>
 #include <span>
 #include <string_view>
 #include <compare>
@@ -27,7 +30,9 @@ template <size_t N> struct hash_value: std::array<std::byte, N> {
 	template <typename CharT> explicit constexpr hash_value(const fixed_string<CharT, N * 2u> & in) noexcept: super{internal::hexdec_to_binary<N>(std::span<const CharT, N * 2u>(in.data(), in.size()))} { }
 
 	// comparison support
-	constexpr friend bool operator==(const hash_value & lhs, const hash_value & rhs) noexcept = default;
+	constexpr friend bool operator==(const hash_value & lhs, const hash_value & rhs) noexcept {
+		return internal::equal_of_same_size(lhs.data(), rhs.data(), N);
+	}
 	constexpr friend auto operator<=>(const hash_value & lhs, const hash_value & rhs) noexcept -> std::strong_ordering {
 		return internal::threeway_compare_of_same_size(lhs.data(), rhs.data(), N);
 	}
@@ -54,6 +59,22 @@ template <size_t N> struct hash_value: std::array<std::byte, N> {
 		std::ranges::copy(this->end() - SuffixN, this->end(), output.begin());
 		return output;
 	}
+
+	// first K bytes as big-endian number (digest is already uniformly distributed, so it's usable as a hash directly)
+	template <size_t K = std::min(N, sizeof(uint64_t))> constexpr auto fingerprint() const noexcept requires(K > 0u && K <= N && K <= sizeof(uint64_t)) {
+		using result_t = internal::unsigned_integral_for_bytes<K>;
+		const auto bytes = prefix<K>();
+
+		if constexpr (K == sizeof(result_t)) {
+			return cast_from_bytes<result_t>(std::span<const std::byte, K>(bytes));
+		} else {
+			result_t output{0u};
+			for (std::byte b: bytes) {
+				output = static_cast<result_t>((output << 8u) | static_cast<result_t>(b));
+			}
+			return output;
+		}
+	}
 	template <typename Encoding = cthash::encoding::hexdec, typename CharT = char> constexpr friend auto to_string(const hash_value & value) {
 		const auto encoded = value | cthash::encode_to<Encoding, CharT>;
 #if __cpp_lib_ranges_to_container >= 202202L
@@ -82,6 +103,11 @@ template <size_t N> struct hash_value: std::array<std::byte, N> {
 	}
 };
 
+// use to compare secrets (MACs, tokens), result is not known sooner than all bytes are compared
+template <size_t N> constexpr bool constant_time_equal(const hash_value<N> & lhs, const hash_value<N> & rhs) noexcept {
+	return internal::constant_time_equal_of_same_size(lhs.data(), rhs.data(), N);
+}
+
 template <typename CharT, size_t N> hash_value(const CharT (&)[N]) -> hash_value<(N - 1u) / 2u>;
 template <typename CharT, size_t N> hash_value(std::span<const CharT, N>) -> hash_value<N / 2u>;
 template <typename CharT, size_t N> hash_value(const fixed_string<CharT, N> &) -> hash_value<N / 2u>;
@@ -147,6 +173,14 @@ namespace literals {
 
 namespace std {
 
+template <size_t N> struct hash<cthash::hash_value<N>> {
+	constexpr size_t operator()(const cthash::hash_value<N> & value) const noexcept {
+		return static_cast<size_t>(value.fingerprint());
+	}
+};
+
+template <typename Tag, size_t N> struct hash<cthash::tagged_hash_value<Tag, N>>: hash<cthash::hash_value<N>> { };
+
 #if __cpp_lib_format >= 201907L
 #define CTHASH_STDFMT_AVAILABLE 1
 #endif
@@ -134,7 +134,23 @@ template <size_t Bits> struct xxhash {
 	std::array<std::byte, sizeof(value_type) * 4u> buffer{};
 
 	// step 1 in constructor
-	explicit constexpr xxhash(value_type s = 0u) noexcept: seed{s}, internal_state{seed + config::primes[0] + config::primes[1], seed + config::primes[1], seed, seed - config::primes[0]} { }
+	explicit constexpr xxhash(value_type s = 0u) noexcept: seed{s}, internal_state{initial_state(s)} { }
+
+	static constexpr auto initial_state(value_type s) noexcept -> acc_array {
+		return {s + config::primes[0] + config::primes[1], s + config::primes[1], s, s - config::primes[0]};
+	}
+
+	// buffer is not cleared, its usage is derived from length
+	constexpr xxhash & reset(value_type s) noexcept {
+		seed = s;
+		length = 0u;
+		internal_state = initial_state(s);
+		return *this;
+	}
+
+	constexpr xxhash & reset() noexcept {
+		return reset(seed);
+	}
 
 	template <byte_like Byte> constexpr void process_lanes(std::span<const Byte, sizeof(acc_array)> lanes) noexcept {
 		// step 2: process lanes
@@ -161,7 +177,7 @@ template <size_t Bits> struct xxhash {
 		const auto buffer_remaining = std::span(buffer).subspan(buffer_usage());
 
 		// everything we insert here is counting as part of input (even if we process it later)
-		length += static_cast<uint8_t>(input.size());
+		length += static_cast<value_type>(input.size());
 
 		// if there is remaining data from previous...
 		if (buffer_remaining.size() != buffer.size()) {
@@ -196,7 +212,27 @@ template <size_t Bits> struct xxhash {
 		return update(std::span(std::data(input), std::size(input) - 1u));
 	}
 
-	// TODO: any range with value convertible to byte
+	template <byte_span_fragments T> [[gnu::flatten]] constexpr xxhash & update(const T & fragments) noexcept {
+		for (const auto & fragment: fragments) {
+			update(fragment_bytes(fragment));
+		}
+		return *this;
+	}
+
+	template <byte_input_range R> [[gnu::flatten]] constexpr xxhash & update(R && range) noexcept {
+		std::array<std::byte, sizeof(acc_array) * 16u> chunk;
+		auto it = std::ranges::begin(range);
+		const auto end = std::ranges::end(range);
+
+		for (;;) {
+			const size_t copied = byte_copy_some(it, end, chunk);
+			update(std::span<const std::byte>(chunk).first(copied));
+
+			if (copied != chunk.size()) {
+				return *this;
+			}
+		}
+	}
 
 	template <byte_like Byte> [[gnu::flatten]] constexpr auto update_and_final(std::span<const Byte> input) noexcept {
 		length = static_cast<value_type>(input.size());
@@ -214,6 +250,17 @@ template <size_t Bits> struct xxhash {
 		return update_and_final(std::span(std::data(input), std::size(input) - 1u));
 	}
 
+	// hash as a number (eg. for hash tables), without conversion to bytes
+	template <byte_like Byte> [[gnu::flatten]] constexpr auto update_and_final_value(std::span<const Byte> input) noexcept -> value_type {
+		length = static_cast<value_type>(input.size());
+		process_blocks(input);
+		return final_value_from(input);
+	}
+
+	template <one_byte_char CharT> [[gnu::flatten]] constexpr auto update_and_final_value(std::basic_string_view<CharT> input) noexcept -> value_type {
+		return update_and_final_value(std::span<const CharT>(input.data(), input.size()));
+	}
+
 	constexpr auto converge_conditionaly() const noexcept -> value_type {
 		// step 1 shortcut for short input
 		if (length < buffer.size()) {
@@ -224,7 +271,7 @@ template <size_t Bits> struct xxhash {
 		return config::convergence(internal_state);
 	}
 
-	template <byte_like Byte> constexpr void final_from(std::span<const Byte> source, digest_span_t out) const noexcept {
+	template <byte_like Byte> constexpr auto final_value_from(std::span<const Byte> source) const noexcept -> value_type {
 		assert(source.size() < buffer.size());
 
 		value_type acc = converge_conditionaly();
@@ -236,10 +283,12 @@ template <size_t Bits> struct xxhash {
 		acc = config::consume_remaining(acc, source);
 
 		// step 6: final mix/avalanche
-		acc = config::avalanche(acc);
+		return config::avalanche(acc);
+	}
 
+	template <byte_like Byte> constexpr void final_from(std::span<const Byte> source, digest_span_t out) const noexcept {
 		// convert to big endian representation
-		unwrap_bigendian_number<value_type>{out} = acc;
+		unwrap_bigendian_number<value_type>{out} = final_value_from(source);
 	}
 
 	[[gnu::flatten]] constexpr void final(digest_span_t out) const noexcept {
@@ -252,6 +301,12 @@ template <size_t Bits> struct xxhash {
 		this->final(output);
 		return output;
 	}
+
+	// final and reset (with same seed)
+	constexpr void hash_into(digest_span_t out) noexcept {
+		this->final(out);
+		reset();
+	}
 };
 
 using xxhash32 = cthash::xxhash<32>;
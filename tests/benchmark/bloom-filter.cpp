@@ -0,0 +1,49 @@
+#include "../internal/support.hpp"
+#include <cthash/containers/bloom-filter.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <memory>
+#include <vector>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+constexpr size_t filter_size = 10u * 1000u * 1000u;
+constexpr size_t lookups = 1000u * 1000u;
+
+const auto & digests() {
+	return lazy_fixture([] { return digests_of<cthash::sha256>(filter_size + lookups); });
+}
+
+template <typename Filter> const auto & filter() {
+	return lazy_fixture([] {
+		auto result = Filter::for_capacity(filter_size, 0.01);
+		result.insert(std::span<const cthash::sha256_value>(digests()).first(filter_size));
+		return result;
+	});
+}
+
+// half of keys are in the filter
+auto keys() {
+	return std::span<const cthash::sha256_value>(digests()).subspan(filter_size - lookups / 2u, lookups);
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("bloom filter query (10M entries)", "[bloom-filter-bench]", cthash::digest_bloom_filter<cthash::sha256_value>, cthash::blocked_digest_bloom_filter<cthash::sha256_value>) {
+	BENCHMARK("1M single queries") {
+		const auto & f = filter<TestType>();
+		size_t found = 0;
+		for (const auto & key: keys()) {
+			found += f.contains(key);
+		}
+		return found;
+	};
+
+	BENCHMARK("1M batch query") {
+		const auto & f = filter<TestType>();
+		auto results = std::make_unique<bool[]>(lookups);
+		return f.contains(keys(), std::span<bool>(results.get(), lookups));
+	};
+}
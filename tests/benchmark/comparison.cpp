@@ -0,0 +1,84 @@
+#include "../internal/support.hpp"
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha2/sha512.hpp>
+#include <algorithm>
+#include <vector>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+constexpr size_t count = 4096u;
+constexpr size_t repeat = 256u;
+
+// pairs are equal (so whole digest must be compared) except for every fourth which differs in the last byte
+template <typename Hasher> auto pairs() {
+	using value_t = decltype(digest_of<Hasher>(0u));
+	std::vector<std::pair<value_t, value_t>> output{};
+	for (size_t i = 0; i != count; ++i) {
+		auto d = digest_of<Hasher>(i);
+		auto other = d;
+		if (i % 4u == 0u) {
+			other.back() = ~other.back();
+		}
+		output.emplace_back(d, other);
+	}
+	return output;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("digest comparison", "[comparison-bench]", cthash::sha256, cthash::sha512) {
+	const auto input = pairs<TestType>();
+
+	BENCHMARK("1M std::equal (byte by byte)") {
+		size_t equal = 0;
+		for (size_t r = 0; r != repeat; ++r) {
+			for (const auto & [lhs, rhs]: input) {
+				equal += std::equal(lhs.begin(), lhs.end(), rhs.begin());
+			}
+		}
+		return equal;
+	};
+
+	BENCHMARK("1M operator==") {
+		size_t equal = 0;
+		for (size_t r = 0; r != repeat; ++r) {
+			for (const auto & [lhs, rhs]: input) {
+				equal += (lhs == rhs);
+			}
+		}
+		return equal;
+	};
+
+	BENCHMARK("1M cthash::constant_time_equal") {
+		size_t equal = 0;
+		for (size_t r = 0; r != repeat; ++r) {
+			for (const auto & [lhs, rhs]: input) {
+				equal += cthash::constant_time_equal(lhs, rhs);
+			}
+		}
+		return equal;
+	};
+
+	BENCHMARK("1M std::lexicographical_compare") {
+		size_t less = 0;
+		for (size_t r = 0; r != repeat; ++r) {
+			for (const auto & [lhs, rhs]: input) {
+				less += std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+			}
+		}
+		return less;
+	};
+
+	BENCHMARK("1M operator<") {
+		size_t less = 0;
+		for (size_t r = 0; r != repeat; ++r) {
+			for (const auto & [lhs, rhs]: input) {
+				less += (lhs < rhs);
+			}
+		}
+		return less;
+	};
+}
@@ -0,0 +1,46 @@
+#include "../internal/support.hpp"
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha3/sha3-256.hpp>
+#include <vector>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+auto split(std::span<const std::byte> in, size_t size) {
+	std::vector<std::span<const std::byte>> output{};
+	while (!in.empty()) {
+		const auto part = in.first(std::min(size, in.size()));
+		output.push_back(part);
+		in = in.subspan(part.size());
+	}
+	return output;
+}
+
+} // namespace
+
+TEST_CASE("fragmented input measurements") {
+	const auto input = std::vector<std::byte>(64u * 1024u, std::byte{0x42});
+	const auto packets = split(input, 1500u);
+	const auto small = split(input, 100u);
+
+	BENCHMARK("sha256 64kB (one span)") {
+		return cthash::sha256{}.update(runtime_pass(input)).final();
+	};
+
+	BENCHMARK("sha256 64kB (1500 byte fragments)") {
+		return cthash::sha256{}.update(runtime_pass(packets)).final();
+	};
+
+	BENCHMARK("sha256 64kB (100 byte fragments)") {
+		return cthash::sha256{}.update(runtime_pass(small)).final();
+	};
+
+	BENCHMARK("sha3-256 64kB (one span)") {
+		return cthash::sha3_256{}.update(runtime_pass(input)).final();
+	};
+
+	BENCHMARK("sha3-256 64kB (1500 byte fragments)") {
+		return cthash::sha3_256{}.update(runtime_pass(packets)).final();
+	};
+}
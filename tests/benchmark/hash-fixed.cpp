@@ -0,0 +1,47 @@
+#include "../internal/support.hpp"
+#include <cthash/hash-fixed.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha2/sha512.hpp>
+#include <cthash/sha3/sha3-256.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("hash_fixed measurements") {
+	std::array<std::byte, 64> input{};
+
+	for (int i = 0; i != (int)input.size(); ++i) {
+		input[static_cast<size_t>(i)] = static_cast<std::byte>(i);
+	}
+
+	BENCHMARK("sha256 32 byte input (update)") {
+		return cthash::sha256{}.update(std::span(runtime_pass(input)).first(32)).final();
+	};
+
+	BENCHMARK("sha256 32 byte input (hash_fixed)") {
+		return cthash::hash_fixed<cthash::sha256>(std::span(runtime_pass(input)).first<32>());
+	};
+
+	BENCHMARK("sha256 64 byte input (update)") {
+		return cthash::sha256{}.update(std::span(runtime_pass(input))).final();
+	};
+
+	BENCHMARK("sha256 64 byte input (hash_fixed)") {
+		return cthash::hash_fixed<cthash::sha256>(std::span(runtime_pass(input)).first<64>());
+	};
+
+	BENCHMARK("sha512 64 byte input (update)") {
+		return cthash::sha512{}.update(std::span(runtime_pass(input))).final();
+	};
+
+	BENCHMARK("sha512 64 byte input (hash_fixed)") {
+		return cthash::hash_fixed<cthash::sha512>(std::span(runtime_pass(input)).first<64>());
+	};
+
+	BENCHMARK("sha3-256 32 byte input (update)") {
+		return cthash::sha3_256{}.update(std::span(runtime_pass(input)).first(32)).final();
+	};
+
+	BENCHMARK("sha3-256 32 byte input (hash_fixed)") {
+		return cthash::hash_fixed<cthash::sha3_256>(std::span(runtime_pass(input)).first<32>());
+	};
+}
@@ -0,0 +1,68 @@
+#include "../internal/support.hpp"
+#include <cthash/hmac.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+constexpr auto key = std::string_view{"this is a secret API key"};
+
+auto benchmark_input() {
+	std::array<std::byte, 1024> input{};
+
+	for (int i = 0; i != (int)input.size(); ++i) {
+		input[static_cast<size_t>(i)] = static_cast<std::byte>(i);
+	}
+
+	return input;
+}
+
+} // namespace
+
+TEST_CASE("hmac-sha256 measurements") {
+	const auto input = benchmark_input();
+	const auto precomputed = cthash::hmac_key<cthash::sha256>{key};
+
+	BENCHMARK("32 byte input") {
+		return cthash::hmac<cthash::sha256>{runtime_pass(key)}.update(std::span(runtime_pass(input)).first(32)).final();
+	};
+
+	BENCHMARK("32 byte input (precomputed key)") {
+		return precomputed.calculate(std::span(runtime_pass(input)).first(32));
+	};
+
+	BENCHMARK("1kB input") {
+		return cthash::hmac<cthash::sha256>{runtime_pass(key)}.update(std::span(runtime_pass(input))).final();
+	};
+
+	BENCHMARK("1kB input (precomputed key)") {
+		return precomputed.calculate(std::span(runtime_pass(input)));
+	};
+}
+
+#ifdef OPENSSL_BENCHMARK
+
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+TEST_CASE("openssl hmac-sha256 measurements") {
+	const auto input = benchmark_input();
+
+	const auto calculate = [](std::span<const std::byte> data) {
+		std::array<unsigned char, 32> res;
+		unsigned length = 0u;
+		HMAC(EVP_sha256(), key.data(), static_cast<int>(key.size()), reinterpret_cast<const unsigned char *>(data.data()), data.size(), res.data(), &length);
+		return res;
+	};
+
+	BENCHMARK("32 byte input") {
+		return calculate(std::span(runtime_pass(input)).first(32));
+	};
+
+	BENCHMARK("1kB input") {
+		return calculate(std::span(runtime_pass(input)));
+	};
+}
+
+#endif
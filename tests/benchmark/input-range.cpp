@@ -0,0 +1,47 @@
+#include "../internal/support.hpp"
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha3/sha3-256.hpp>
+#include <cthash/xxhash.hpp>
+#include <iterator>
+#include <ranges>
+#include <sstream>
+#include <vector>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("input range measurements") {
+	const auto input = std::vector<char>(64u * 1024u, 'x');
+	const auto as_bytes = [](char c) { return static_cast<std::byte>(c); };
+
+	BENCHMARK("sha256 64kB (span)") {
+		return cthash::sha256{}.update(runtime_pass(input)).final();
+	};
+
+	BENCHMARK("sha256 64kB (transformed view)") {
+		return cthash::sha256{}.update(runtime_pass(input) | std::views::transform(as_bytes)).final();
+	};
+
+	BENCHMARK_ADVANCED("sha256 64kB (istreambuf_iterator)")(Catch::Benchmark::Chronometer meter) {
+		auto stream = std::istringstream{std::string(input.begin(), input.end())};
+		meter.measure([&] {
+			stream.seekg(0);
+			return cthash::sha256{}.update(std::ranges::subrange(std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{})).final();
+		});
+	};
+
+	BENCHMARK("sha3-256 64kB (span)") {
+		return cthash::sha3_256{}.update(runtime_pass(input)).final();
+	};
+
+	BENCHMARK("sha3-256 64kB (transformed view)") {
+		return cthash::sha3_256{}.update(runtime_pass(input) | std::views::transform(as_bytes)).final();
+	};
+
+	BENCHMARK("xxhash64 64kB (span)") {
+		return cthash::xxhash64{}.update(std::span<const char>(runtime_pass(input))).final();
+	};
+
+	BENCHMARK("xxhash64 64kB (transformed view)") {
+		return cthash::xxhash64{}.update(runtime_pass(input) | std::views::transform(as_bytes)).final();
+	};
+}
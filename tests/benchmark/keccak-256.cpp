@@ -0,0 +1,49 @@
+#include "../internal/support.hpp"
+#include <cthash/sha3/keccak-fixed.hpp>
+#include <vector>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+template <size_t N> auto generated_inputs(size_t count) {
+	std::vector<std::array<std::byte, N>> output(count);
+	for (size_t i = 0; i != count; ++i) {
+		for (size_t j = 0; j != N; ++j) {
+			output[i][j] = static_cast<std::byte>(i * 31u + j);
+		}
+	}
+	return output;
+}
+
+template <size_t N> void keccak_256_batch_benchmarks() {
+	// 4096 hashes per run (hashes/sec = 4096 / mean)
+	const auto inputs = generated_inputs<N>(4096u);
+	std::vector<cthash::keccak_256_value> outputs(inputs.size());
+
+	BENCHMARK("keccak_256 update+final 4096x " + std::to_string(N) + "B") {
+		for (size_t i = 0; i != inputs.size(); ++i) {
+			outputs[i] = cthash::keccak_256{}.update(runtime_pass(inputs)[i]).final();
+		}
+		return outputs[0];
+	};
+
+	BENCHMARK("keccak_256_fixed 4096x " + std::to_string(N) + "B") {
+		for (size_t i = 0; i != inputs.size(); ++i) {
+			outputs[i] = cthash::keccak_256_fixed<N>(runtime_pass(inputs)[i]);
+		}
+		return outputs[0];
+	};
+
+	BENCHMARK("keccak_256_many 4096x " + std::to_string(N) + "B") {
+		cthash::keccak_256_many(std::span<const std::array<std::byte, N>>(runtime_pass(inputs)), std::span<cthash::keccak_256_value>(outputs));
+		return outputs[0];
+	};
+}
+
+} // namespace
+
+TEST_CASE("keccak-256 batch measurements") {
+	keccak_256_batch_benchmarks<32>();
+	keccak_256_batch_benchmarks<64>();
+}
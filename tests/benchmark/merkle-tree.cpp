@@ -0,0 +1,43 @@
+#include "../internal/support.hpp"
+#include <cthash/containers/merkle-tree.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha3/keccak.hpp>
+#include <vector>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("merkle_tree measurements") {
+	using tree_t = cthash::merkle_tree<cthash::sha256>;
+
+	std::vector<cthash::sha256_value> leaves{};
+	for (uint64_t i = 0; i != (1u << 16u); ++i) {
+		leaves.push_back(tree_t::hash_leaf(std::span<const std::byte, sizeof(i)>(reinterpret_cast<const std::byte *>(&i), sizeof(i))));
+	}
+
+	BENCHMARK("sha256 64k leaves (node by node with update)") {
+		std::vector<cthash::sha256_value> level = runtime_pass(leaves);
+		const auto prefix = std::array<std::byte, 1>{std::byte{0x01}};
+		while (level.size() > 1u) {
+			for (size_t i = 0; i != level.size() / 2u; ++i) {
+				level[i] = cthash::sha256{}.update(std::span<const std::byte>(prefix)).update(level[2u * i]).update(level[2u * i + 1u]).final();
+			}
+			level.resize(level.size() / 2u);
+		}
+		return level[0];
+	};
+
+	BENCHMARK("sha256 64k leaves (merkle_tree)") {
+		return tree_t::from_leaf_hashes(runtime_pass(leaves)).root();
+	};
+
+	BENCHMARK("sha256 64k leaves (merkle_tree, 4 threads)") {
+		return tree_t::from_leaf_hashes(runtime_pass(leaves), 4u).root();
+	};
+
+	using keccak_tree_t = cthash::merkle_tree<cthash::keccak_256, cthash::no_prefixes>;
+	std::vector<cthash::keccak_256_value> keccak_leaves(leaves.size());
+
+	BENCHMARK("keccak-256 64k leaves (merkle_tree)") {
+		return keccak_tree_t::from_leaf_hashes(runtime_pass(keccak_leaves)).root();
+	};
+}
@@ -0,0 +1,42 @@
+#include "../internal/support.hpp"
+#include <cthash/containers/mpt-root.hpp>
+#include <vector>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("mpt_root measurements") {
+	constexpr size_t count = 1u << 16u;
+
+	std::vector<cthash::keccak_256_value> keys(count);
+	std::vector<std::array<std::byte, 70>> values(count);
+
+	for (uint64_t i = 0; i != count; ++i) {
+		keys[i] = cthash::keccak_256{}.update(std::span<const std::byte, sizeof(i)>(reinterpret_cast<const std::byte *>(&i), sizeof(i))).final();
+		values[i].fill(static_cast<std::byte>(i));
+	}
+
+	const auto build = [&] {
+		auto trie = cthash::mpt_root{};
+		for (size_t i = 0; i != count; ++i) {
+			trie.insert(keys[i], values[i]);
+		}
+		return trie;
+	};
+
+	BENCHMARK("64k keys (build + root)") {
+		auto trie = build();
+		return trie.root();
+	};
+
+	auto trie = build();
+	trie.root();
+
+	BENCHMARK("64k keys (root after 256 updates)") {
+		for (size_t i = 0; i != 256u; ++i) {
+			const size_t index = (i * 251u) % count;
+			values[index][0] = static_cast<std::byte>(static_cast<uint8_t>(values[index][0]) + 1u);
+			trie.insert(keys[index], values[index]);
+		}
+		return trie.root();
+	};
+}
@@ -0,0 +1,28 @@
+#include "../internal/support.hpp"
+#include <cthash/sha3/kmac.hpp>
+#include <cthash/sha3/parallelhash.hpp>
+#include <cthash/sha3/shake128.hpp>
+#include <vector>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("parallel_hash measurements") {
+	const auto input = std::vector<std::byte>(4u * 1024u * 1024u, std::byte{0x42});
+	const auto view = std::span<const std::byte>(input);
+
+	BENCHMARK("shake128 4MB") {
+		return cthash::shake128{}.update(runtime_pass(view)).final<256>();
+	};
+
+	BENCHMARK("parallel_hash128 4MB (B = 8192)") {
+		return cthash::parallel_hash128<>{8192u}.update(runtime_pass(view)).final<256>();
+	};
+
+	BENCHMARK("parallel_hash128 4MB (B = 8192, 4 threads)") {
+		return cthash::parallel_hash128<>{8192u, 4u}.update(runtime_pass(view)).final<256>();
+	};
+
+	BENCHMARK("kmac128 4MB") {
+		return cthash::kmac128<"benchmark">{"key"}.update(runtime_pass(view)).final<256>();
+	};
+}
@@ -0,0 +1,59 @@
+#include "../internal/support.hpp"
+#include <cthash/pbkdf2.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+constexpr size_t iterations = 10'000u;
+
+constexpr auto passwords = std::array<std::string_view, 8>{"password1", "password2", "password3", "password4", "password5", "password6", "password7", "password8"};
+
+} // namespace
+
+TEST_CASE("pbkdf2-hmac-sha256 measurements") {
+	BENCHMARK("32 byte output (10k iterations)") {
+		return cthash::pbkdf2<cthash::sha256>(runtime_pass(passwords[0]), std::string_view{"salt"}, iterations);
+	};
+
+	BENCHMARK("256 byte output (10k iterations, 8 blocks in lanes)") {
+		return cthash::pbkdf2<cthash::sha256, 256>(runtime_pass(passwords[0]), std::string_view{"salt"}, iterations);
+	};
+
+	BENCHMARK("8 passwords one by one (10k iterations)") {
+		std::array<cthash::hash_value<32>, 8> output;
+		for (size_t i = 0; i != passwords.size(); ++i) {
+			output[i] = cthash::pbkdf2<cthash::sha256>(runtime_pass(passwords[i]), std::string_view{"salt"}, iterations);
+		}
+		return output;
+	};
+
+	BENCHMARK("8 passwords in lanes (10k iterations)") {
+		return cthash::pbkdf2_batch<cthash::sha256>(passwords, std::string_view{"salt"}, iterations);
+	};
+}
+
+#ifdef OPENSSL_BENCHMARK
+
+#include <openssl/evp.h>
+
+TEST_CASE("openssl pbkdf2-hmac-sha256 measurements") {
+	const auto calculate = [](std::string_view password, std::span<unsigned char> output) {
+		PKCS5_PBKDF2_HMAC(password.data(), static_cast<int>(password.size()), reinterpret_cast<const unsigned char *>("salt"), 4, static_cast<int>(iterations), EVP_sha256(), static_cast<int>(output.size()), output.data());
+	};
+
+	BENCHMARK("32 byte output (10k iterations)") {
+		std::array<unsigned char, 32> res;
+		calculate(runtime_pass(passwords[0]), res);
+		return res;
+	};
+
+	BENCHMARK("256 byte output (10k iterations)") {
+		std::array<unsigned char, 256> res;
+		calculate(runtime_pass(passwords[0]), res);
+		return res;
+	};
+}
+
+#endif
@@ -0,0 +1,131 @@
+#include "../internal/support.hpp"
+#include <cthash/containers/perfect-hash.hpp>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+template <size_t N> const auto & key_storage() {
+	return lazy_fixture([] {
+		std::vector<std::string> result{};
+		result.reserve(N);
+		for (size_t i = 0; i != N; ++i) {
+			result.push_back("identifier_" + std::to_string(i * 7919u));
+		}
+		return result;
+	});
+}
+
+template <size_t N> const auto & keys() {
+	return *lazy_fixture([] {
+		auto result = std::make_unique<std::array<std::string_view, N>>();
+		std::copy(key_storage<N>().begin(), key_storage<N>().end(), result->begin());
+		return result;
+	});
+}
+
+template <size_t N> const auto & perfect_table() {
+	return *lazy_fixture([] { return std::make_unique<cthash::perfect_hash_table<N>>(keys<N>()); });
+}
+
+template <size_t N> const auto & unordered_table() {
+	return lazy_fixture([] {
+		std::unordered_map<std::string_view, size_t> result{};
+		result.reserve(N);
+		for (size_t i = 0; i != N; ++i) {
+			result.emplace(keys<N>()[i], i);
+		}
+		return result;
+	});
+}
+
+template <size_t N> const auto & sorted_keys() {
+	return *lazy_fixture([] {
+		auto result = std::make_unique<std::array<std::string_view, N>>(keys<N>());
+		std::sort(result->begin(), result->end());
+		return result;
+	});
+}
+
+template <size_t N> void lookup_benchmarks() {
+	constexpr size_t lookups = 1000u * 1000u;
+
+	BENCHMARK("cthash::perfect_hash_table construction") {
+		return std::make_unique<cthash::perfect_hash_table<N>>(keys<N>())->seed();
+	};
+
+	BENCHMARK("1M cthash::perfect_hash_table::find") {
+		const auto & table = perfect_table<N>();
+		const auto & k = keys<N>();
+		size_t sum = 0;
+		for (size_t i = 0; i != lookups; ++i) {
+			sum += table.find(k[(i * 7919u) % N]);
+		}
+		return sum;
+	};
+
+	BENCHMARK("1M std::unordered_map<std::string_view, size_t>::find") {
+		const auto & table = unordered_table<N>();
+		const auto & k = keys<N>();
+		size_t sum = 0;
+		for (size_t i = 0; i != lookups; ++i) {
+			sum += table.find(k[(i * 7919u) % N])->second;
+		}
+		return sum;
+	};
+
+	BENCHMARK("1M std::lower_bound in sorted std::array") {
+		const auto & sorted = sorted_keys<N>();
+		const auto & k = keys<N>();
+		size_t sum = 0;
+		for (size_t i = 0; i != lookups; ++i) {
+			sum += static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), k[(i * 7919u) % N]) - sorted.begin());
+		}
+		return sum;
+	};
+
+	BENCHMARK("1M missing keys cthash::perfect_hash_table::find") {
+		const auto & table = perfect_table<N>();
+		const auto & k = keys<N>();
+		size_t found = 0;
+		for (size_t i = 0; i != lookups; ++i) {
+			const auto key = k[(i * 7919u) % N];
+			found += table.contains(key.substr(1u));
+		}
+		return found;
+	};
+
+	BENCHMARK("1M missing keys std::unordered_map<std::string_view, size_t>::find") {
+		const auto & table = unordered_table<N>();
+		const auto & k = keys<N>();
+		size_t found = 0;
+		for (size_t i = 0; i != lookups; ++i) {
+			const auto key = k[(i * 7919u) % N];
+			found += table.contains(key.substr(1u));
+		}
+		return found;
+	};
+}
+
+} // namespace
+
+TEST_CASE("perfect hash table lookup (100 keys)", "[perfect-hash-bench]") {
+	lookup_benchmarks<100u>();
+}
+
+TEST_CASE("perfect hash table lookup (1k keys)", "[perfect-hash-bench]") {
+	lookup_benchmarks<1000u>();
+}
+
+TEST_CASE("perfect hash table lookup (10k keys)", "[perfect-hash-bench]") {
+	lookup_benchmarks<10u * 1000u>();
+}
+
+TEST_CASE("perfect hash table lookup (100k keys)", "[perfect-hash-bench]") {
+	lookup_benchmarks<100u * 1000u>();
+}
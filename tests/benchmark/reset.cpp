@@ -0,0 +1,49 @@
+#include "../internal/support.hpp"
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha3/sha3-256.hpp>
+#include <cthash/xxhash.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("reset measurements") {
+	std::array<std::byte, 16> input{};
+	constexpr int messages = 1000;
+
+	BENCHMARK("sha3-256 1000 short messages (new hasher)") {
+		cthash::sha3_256_value output;
+		for (int i = 0; i != messages; ++i) {
+			input[0] = static_cast<std::byte>(i);
+			cthash::sha3_256{}.update(runtime_pass(input)).final(output);
+		}
+		return output;
+	};
+
+	BENCHMARK("sha3-256 1000 short messages (hash_into)") {
+		cthash::sha3_256_value output;
+		cthash::sha3_256 h{};
+		for (int i = 0; i != messages; ++i) {
+			input[0] = static_cast<std::byte>(i);
+			h.update(runtime_pass(input)).hash_into(output);
+		}
+		return output;
+	};
+
+	BENCHMARK("sha256 1000 short messages (new hasher)") {
+		cthash::sha256_value output;
+		for (int i = 0; i != messages; ++i) {
+			input[0] = static_cast<std::byte>(i);
+			cthash::sha256{}.update(runtime_pass(input)).final(output);
+		}
+		return output;
+	};
+
+	BENCHMARK("sha256 1000 short messages (hash_into)") {
+		cthash::sha256_value output;
+		cthash::sha256 h{};
+		for (int i = 0; i != messages; ++i) {
+			input[0] = static_cast<std::byte>(i);
+			h.update(runtime_pass(input)).hash_into(output);
+		}
+		return output;
+	};
+}
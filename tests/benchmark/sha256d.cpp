@@ -0,0 +1,34 @@
+#include "../internal/support.hpp"
+#include <cthash/sha2/sha256d.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("sha256d header sweep measurements") {
+	std::array<std::byte, 80> header{};
+	for (size_t i = 0; i != header.size(); ++i) {
+		header[i] = static_cast<std::byte>(i);
+	}
+
+	// nothing passes, so all nonces are evaluated
+	const auto target = cthash::hash_value<32>{};
+	constexpr uint32_t nonces = 4096u;
+
+	BENCHMARK("4096 nonces (sha256d one by one)") {
+		auto h = header;
+		for (uint32_t nonce = 0; nonce != nonces; ++nonce) {
+			cthash::unwrap_littleendian_number<uint32_t>{std::span(h).last<4>()} = nonce;
+			if (cthash::sha256d{}.update(h).final() == target) {
+				return nonce;
+			}
+		}
+		return nonces;
+	};
+
+	BENCHMARK("4096 nonces (sweep, 8 lanes)") {
+		return cthash::sha256d_header_sweep<8>(header, {0u, nonces}, target);
+	};
+
+	BENCHMARK("4096 nonces (sweep, 16 lanes)") {
+		return cthash::sha256d_header_sweep<16>(header, {0u, nonces}, target);
+	};
+}
@@ -1,6 +1,9 @@
 #include "../internal/support.hpp"
 #include <cthash/sha3/sha3-256.hpp>
+#include <cthash/sha3/shake128.hpp>
+#include <cthash/sha3/shake256.hpp>
 #include <memory>
+#include <vector>
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
@@ -74,6 +77,45 @@ TEST_CASE("sha3-256 measurements", "[keccak-bench]") {
 	};
 }
 
+TEST_CASE("keccak bulk absorb measurements", "[keccak-bench]") {
+	// one contiguous span, so all full blocks go through absorb_block
+	const auto input = std::vector<std::byte>(4u * 1024u * 1024u, std::byte{0x42});
+
+	BENCHMARK("sha3-256 4MB contiguous input") {
+		return cthash::sha3_256{}.update(runtime_pass(input)).final();
+	};
+
+	BENCHMARK("shake128 4MB contiguous input") {
+		return cthash::shake128{}.update(runtime_pass(input)).final<256>();
+	};
+}
+
+TEST_CASE("keccak finalization measurements", "[keccak-bench]") {
+	// messages shorter than one block, so each hash is one permutation and squeeze of the digest
+	std::array<std::byte, 32> input{};
+	std::vector<cthash::sha3_256_value> digests(1000u);
+
+	BENCHMARK("sha3-256 1000x empty input") {
+		for (auto & digest: digests) {
+			digest = cthash::sha3_256{}.final();
+		}
+		return digests.back();
+	};
+
+	BENCHMARK("sha3-256 1000x 32 byte input") {
+		for (size_t i = 0; i != digests.size(); ++i) {
+			input[0] = static_cast<std::byte>(i);
+			digests[i] = cthash::sha3_256{}.update(runtime_pass(input)).final();
+		}
+		return digests.back();
+	};
+
+	// long output is squeezed in whole blocks
+	BENCHMARK("shake256 16kB output") {
+		return cthash::shake256{}.update(runtime_pass(input)).final<16u * 1024u * 8u>();
+	};
+}
+
 #ifdef OPENSSL_BENCHMARK
 
 #include <openssl/evp.h>
@@ -0,0 +1,55 @@
+#include "../internal/support.hpp"
+#include <cthash/sha3/shake-drbg.hpp>
+#include <random>
+#include <vector>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("shake_drbg measurements") {
+	constexpr size_t count = 64u * 1024u;
+
+	BENCHMARK("std::mt19937_64 64k numbers") {
+		auto gen = std::mt19937_64{42u};
+		uint64_t sum = 0u;
+		for (size_t i = 0; i != count; ++i) {
+			sum += gen();
+		}
+		return sum;
+	};
+
+	BENCHMARK("shake128_drbg 64k numbers") {
+		auto gen = cthash::shake128_drbg{runtime_pass("seed")};
+		uint64_t sum = 0u;
+		for (size_t i = 0; i != count; ++i) {
+			sum += gen();
+		}
+		return sum;
+	};
+
+	std::vector<std::byte> output(count * sizeof(uint64_t));
+
+	BENCHMARK("shake128_drbg 512kB generate") {
+		auto gen = cthash::shake128_drbg{runtime_pass("seed")};
+		gen.generate(output);
+		return output[0];
+	};
+
+	std::array<std::vector<std::byte>, 4> outputs;
+	for (auto & v: outputs) {
+		v.resize(output.size() / 4u);
+	}
+
+	BENCHMARK("shake128_drbg 4x 128kB (separate streams)") {
+		auto streams = cthash::shake_drbg_streams<128u, 4u>{runtime_pass("seed")};
+		for (size_t i = 0; i != 4u; ++i) {
+			streams.stream(i).generate(outputs[i]);
+		}
+		return outputs[0][0];
+	};
+
+	BENCHMARK("shake128_drbg 4x 128kB (shake_drbg_streams)") {
+		auto streams = cthash::shake_drbg_streams<128u, 4u>{runtime_pass("seed")};
+		streams.generate({outputs[0], outputs[1], outputs[2], outputs[3]});
+		return outputs[0][0];
+	};
+}
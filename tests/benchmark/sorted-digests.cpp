@@ -0,0 +1,78 @@
+#include "../internal/support.hpp"
+#include <cthash/containers/sorted-digests.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <vector>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+template <size_t N> const auto & unsorted_digests() {
+	return lazy_fixture([] { return digests_of<cthash::sha256>(N); });
+}
+
+template <size_t N> const auto & sorted_digests() {
+	return lazy_fixture([] { return cthash::sorted_digests<cthash::sha256_value>(unsorted_digests<N>()); });
+}
+
+template <size_t N> const auto & eytzinger_digests() {
+	return lazy_fixture([] { return cthash::eytzinger_index<cthash::sha256_value>(sorted_digests<N>().span()); });
+}
+
+template <size_t N> void sorting_and_searching_benchmarks() {
+	constexpr size_t lookups = 1000u * 1000u;
+
+	// both sorts are measured including copying of the input
+	BENCHMARK("std::sort") {
+		auto copy = unsorted_digests<N>();
+		std::sort(copy.begin(), copy.end());
+		return copy.front();
+	};
+
+	BENCHMARK("cthash::radix_sort") {
+		auto copy = unsorted_digests<N>();
+		cthash::radix_sort(std::span(copy));
+		return copy.front();
+	};
+
+	BENCHMARK("1M std::lower_bound") {
+		const auto & sorted = sorted_digests<N>();
+		const auto & keys = unsorted_digests<N>();
+		size_t sum = 0;
+		for (size_t i = 0; i != lookups; ++i) {
+			sum += static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), keys[(i * 7919u) % keys.size()]) - sorted.begin());
+		}
+		return sum;
+	};
+
+	BENCHMARK("1M cthash::interpolation_lower_bound") {
+		const auto & sorted = sorted_digests<N>();
+		const auto & keys = unsorted_digests<N>();
+		size_t sum = 0;
+		for (size_t i = 0; i != lookups; ++i) {
+			sum += sorted.lower_bound(keys[(i * 7919u) % keys.size()]);
+		}
+		return sum;
+	};
+
+	BENCHMARK("1M cthash::eytzinger_index::lower_bound") {
+		const auto & index = eytzinger_digests<N>();
+		const auto & keys = unsorted_digests<N>();
+		size_t found = 0;
+		for (size_t i = 0; i != lookups; ++i) {
+			found += (index.lower_bound(keys[(i * 7919u) % keys.size()]) != nullptr);
+		}
+		return found;
+	};
+}
+
+} // namespace
+
+TEST_CASE("sorted digests (1M)", "[sorted-digests-bench]") {
+	sorting_and_searching_benchmarks<1000u * 1000u>();
+}
+
+// needs ~10GB of memory, run explicitly
+TEST_CASE("sorted digests (100M)", "[.][sorted-digests-bench-100M]") {
+	sorting_and_searching_benchmarks<100u * 1000u * 1000u>();
+}
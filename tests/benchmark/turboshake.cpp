@@ -0,0 +1,19 @@
+#include "../internal/support.hpp"
+#include <cthash/sha3/shake128.hpp>
+#include <cthash/sha3/turboshake.hpp>
+#include <vector>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("turboshake measurements") {
+	const auto input = std::vector<std::byte>(1024u * 1024u, std::byte{0x42});
+	const auto view = std::span<const std::byte>(input);
+
+	BENCHMARK("shake128 1MB (24 rounds)") {
+		return cthash::shake128{}.update(runtime_pass(view)).final<256>();
+	};
+
+	BENCHMARK("turboshake128 1MB (12 rounds)") {
+		return cthash::turboshake128<>{}.update(runtime_pass(view)).final<256>();
+	};
+}
@@ -0,0 +1,94 @@
+#include "../internal/support.hpp"
+#include <cthash/containers/digest-set.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <unordered_map>
+#include <vector>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+constexpr size_t table_size = 10u * 1000u * 1000u;
+
+const auto & digests() {
+	return lazy_fixture([] { return digests_of<cthash::sha256>(table_size); });
+}
+
+const auto & table() {
+	return lazy_fixture([] {
+		std::unordered_map<cthash::sha256_value, size_t> result{};
+		result.reserve(table_size);
+		size_t i = 0;
+		for (const auto & digest: digests()) {
+			result.emplace(digest, i++);
+		}
+		return result;
+	});
+}
+
+const auto & flat_table() {
+	return lazy_fixture([] {
+		cthash::digest_map<cthash::sha256_value, size_t> result{};
+		result.reserve(table_size);
+		size_t i = 0;
+		for (const auto & digest: digests()) {
+			result.try_emplace(digest, i++);
+		}
+		return result;
+	});
+}
+
+} // namespace
+
+TEST_CASE("std::unordered_map<sha256_value> lookup (10M entries)", "[hash-table-bench]") {
+	BENCHMARK("1M lookups of existing keys") {
+		const auto & t = table();
+		const auto & d = digests();
+		size_t sum = 0;
+		for (size_t i = 0; i != 1000u * 1000u; ++i) {
+			sum += t.find(d[(i * 7919u) % d.size()])->second;
+		}
+		return sum;
+	};
+
+	BENCHMARK("1M lookups of missing keys") {
+		const auto & t = table();
+		const auto & d = digests();
+		size_t found = 0;
+		for (size_t i = 0; i != 1000u * 1000u; ++i) {
+			auto key = d[(i * 7919u) % d.size()];
+			key[31] = ~key[31];
+			found += t.contains(key);
+		}
+		return found;
+	};
+}
+
+TEST_CASE("cthash::digest_map<sha256_value> lookup (10M entries)", "[hash-table-bench]") {
+	BENCHMARK("1M lookups of existing keys") {
+		const auto & t = flat_table();
+		const auto & d = digests();
+		size_t sum = 0;
+		for (size_t i = 0; i != 1000u * 1000u; ++i) {
+			sum += t.find(d[(i * 7919u) % d.size()])->second;
+		}
+		return sum;
+	};
+
+	BENCHMARK("1M lookups of missing keys") {
+		const auto & t = flat_table();
+		const auto & d = digests();
+		size_t found = 0;
+		for (size_t i = 0; i != 1000u * 1000u; ++i) {
+			auto key = d[(i * 7919u) % d.size()];
+			key[31] = ~key[31];
+			found += t.contains(key);
+		}
+		return found;
+	};
+
+	BENCHMARK("bulk insert of 10M digests") {
+		cthash::digest_set<cthash::sha256_value> set{};
+		return set.insert(std::span<const cthash::sha256_value>(digests()));
+	};
+}
@@ -0,0 +1,41 @@
+#include "../internal/support.hpp"
+#include <cthash/sha3/shake128.hpp>
+#include <vector>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("xof measurements") {
+	const auto seed = std::array<std::byte, 32>{};
+	std::vector<std::byte> output(256u * 1024u);
+
+	BENCHMARK("shake128 256kB output (squeeze)") {
+		auto h = cthash::shake128{}.update(runtime_pass(seed));
+		h.final_absorb();
+		h.squeeze(output);
+		return output[0];
+	};
+
+	BENCHMARK("shake128 256kB output (xof_reader, 168 byte reads)") {
+		auto reader = cthash::shake128{}.update(runtime_pass(seed)).finalize_xof();
+		for (size_t offset = 0; offset < output.size(); offset += 168u) {
+			reader.read(std::span(output).subspan(offset, std::min<size_t>(168u, output.size() - offset)));
+		}
+		return output[0];
+	};
+
+	BENCHMARK("shake128 4x 64kB output (separate readers)") {
+		for (size_t l = 0; l != 4u; ++l) {
+			auto reader = cthash::shake128{}.update(runtime_pass(seed)).finalize_xof();
+			reader.read(std::span(output).subspan(l * 65536u, 65536u));
+		}
+		return output[0];
+	};
+
+	BENCHMARK("shake128 4x 64kB output (read_lanes)") {
+		auto reader = cthash::shake128{}.update(runtime_pass(seed)).finalize_xof();
+		auto readers = std::array{reader, reader, reader, reader};
+		const auto out = std::span(output);
+		cthash::read_lanes(readers, std::array{out.subspan(0u, 65536u), out.subspan(65536u, 65536u), out.subspan(131072u, 65536u), out.subspan(196608u, 65536u)});
+		return output[0];
+	};
+}
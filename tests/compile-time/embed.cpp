@@ -0,0 +1,34 @@
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha3/sha3-256.hpp>
+#include <array>
+#include <span>
+
+// digest of an embedded file calculated during compilation, the whole compiler invocation is measured
+// (see `compile-time-benchmark` target in tests/CMakeLists.txt)
+
+#if defined(__has_embed)
+
+constexpr unsigned char input[] = {
+#embed CTHASH_EMBED_FILE
+};
+
+#else
+
+// compilers without #embed get generated input of the same size
+constexpr auto input = [] {
+	std::array<unsigned char, CTHASH_EMBED_SIZE> output{};
+	for (unsigned char & c: output) {
+		c = 'x';
+	}
+	return output;
+}();
+
+#endif
+
+static_assert(std::size(input) == CTHASH_EMBED_SIZE);
+
+constexpr auto digest = CTHASH_EMBED_HASHER{}.update(std::span<const unsigned char>(input)).final();
+
+auto embedded_digest() noexcept {
+	return digest;
+}
@@ -0,0 +1,148 @@
+#include "../internal/support.hpp"
+#include <cthash/containers/bloom-filter.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha3/sha3-256.hpp>
+#include <memory>
+#include <vector>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+auto digests(size_t from, size_t to) {
+	std::vector<cthash::sha256_value> output{};
+	for (size_t i = from; i != to; ++i) {
+		output.push_back(digest_of<cthash::sha256>(i));
+	}
+	return output;
+}
+
+} // namespace
+
+TEST_CASE("digest bits extraction") {
+	constexpr auto v = cthash::hash_value{"0123456789abcdef"};
+
+	STATIC_REQUIRE(cthash::internal::digest_bits(v, 0u, 8u) == 0x01u);
+	STATIC_REQUIRE(cthash::internal::digest_bits(v, 4u, 8u) == 0x12u);
+	STATIC_REQUIRE(cthash::internal::digest_bits(v, 4u, 12u) == 0x123u);
+	STATIC_REQUIRE(cthash::internal::digest_bits(v, 7u, 1u) == 0x1u);
+	STATIC_REQUIRE(cthash::internal::digest_bits(v, 6u, 1u) == 0x0u);
+	STATIC_REQUIRE(cthash::internal::digest_bits(v, 8u, 56u) == 0x23456789abcdefu);
+	STATIC_REQUIRE(cthash::internal::digest_bits(v, 60u, 4u) == 0xfu);
+}
+
+TEST_CASE("bloom filter (constexpr)") {
+	constexpr bool result = [] {
+		auto filter = cthash::digest_bloom_filter<cthash::sha256_value>(12u, 4u);
+		filter.insert(cthash::sha256{}.update("hello").final());
+		return filter.contains(cthash::sha256{}.update("hello").final()) && !filter.contains(cthash::sha256{}.update("world").final());
+	}();
+
+	STATIC_REQUIRE(result);
+}
+
+TEMPLATE_TEST_CASE("bloom filter", "[bloom]", cthash::digest_bloom_filter<cthash::sha256_value>, cthash::blocked_digest_bloom_filter<cthash::sha256_value>) {
+	const auto inserted = digests(0u, 10000u);
+	const auto others = digests(10000u, 110000u);
+
+	auto filter = TestType::for_capacity(inserted.size(), 0.01);
+
+	REQUIRE(filter.number_of_hashes() >= 5u);
+	REQUIRE(filter.size_in_bits() >= 10000u * 9u);
+
+	for (const auto & d: inserted) {
+		REQUIRE(!filter.contains(d));
+	}
+
+	filter.insert(std::span<const cthash::sha256_value>(inserted));
+
+	// no false negatives
+	for (const auto & d: inserted) {
+		REQUIRE(filter.contains(d));
+	}
+
+	size_t false_positives = 0u;
+	for (const auto & d: others) {
+		false_positives += filter.contains(d);
+	}
+
+	REQUIRE(false_positives < 3000u);
+
+	SECTION("batch query") {
+		auto results = std::make_unique<bool[]>(others.size());
+		REQUIRE(filter.contains(std::span<const cthash::sha256_value>(others), std::span<bool>(results.get(), others.size())) == false_positives);
+
+		for (size_t i = 0; i != others.size(); ++i) {
+			REQUIRE(results[i] == filter.contains(others[i]));
+		}
+	}
+
+	SECTION("serialization") {
+		const auto bytes = filter.serialize();
+		REQUIRE(bytes.size() == filter.serialized_size());
+		REQUIRE(bytes.size() == 64u + filter.size_in_bits() / 8u);
+
+		const auto view = TestType::view(bytes);
+		REQUIRE(view.has_value());
+		REQUIRE(view->number_of_hashes() == filter.number_of_hashes());
+		REQUIRE(view->size_in_bits() == filter.size_in_bits());
+
+		const auto copy = TestType::load(bytes);
+		REQUIRE(copy.has_value());
+
+		for (const auto & d: inserted) {
+			REQUIRE(view->contains(d));
+			REQUIRE(copy->contains(d));
+		}
+
+		for (size_t i = 0; i != 1000u; ++i) {
+			REQUIRE(view->contains(others[i]) == filter.contains(others[i]));
+			REQUIRE(copy->contains(others[i]) == filter.contains(others[i]));
+		}
+
+		// truncated
+		REQUIRE(!TestType::view(std::span(bytes).first(bytes.size() - 1u)).has_value());
+		REQUIRE(!TestType::view(std::span(bytes).first(10u)).has_value());
+
+		// wrong magic
+		auto broken = bytes;
+		broken[0] = std::byte{'x'};
+		REQUIRE(!TestType::view(broken).has_value());
+
+		// different digest
+		REQUIRE(!cthash::digest_bloom_filter<cthash::hash_value<8>>::view(bytes).has_value());
+	}
+}
+
+TEST_CASE("bloom filter serialized format") {
+	auto filter = cthash::blocked_digest_bloom_filter<cthash::sha3_256_value>(1u, 3u);
+	const auto bytes = filter.serialize();
+
+	REQUIRE(bytes.size() == 64u + 2u * 64u);
+	REQUIRE(std::string_view(reinterpret_cast<const char *>(bytes.data()), 8u) == "cthbloom");
+	REQUIRE(bytes[8] == std::byte{1});	// version
+	REQUIRE(bytes[12] == std::byte{1}); // blocked layout
+	REQUIRE(bytes[16] == std::byte{32}); // digest length
+	REQUIRE(bytes[20] == std::byte{1});	// log2 size
+	REQUIRE(bytes[24] == std::byte{3});	// hashes
+	REQUIRE(bytes[32] == std::byte{16}); // words
+
+	// different layout
+	REQUIRE(!cthash::digest_bloom_filter<cthash::sha3_256_value>::view(bytes).has_value());
+}
+
+TEST_CASE("bloom filter parameters are limited by digest size") {
+	using filter = cthash::digest_bloom_filter<cthash::sha256_value>;
+
+	STATIC_REQUIRE(filter::valid_parameters(32u, 8u));
+	STATIC_REQUIRE(!filter::valid_parameters(32u, 9u));
+	STATIC_REQUIRE(!filter::valid_parameters(8u, 1u));
+
+	using blocked = cthash::blocked_digest_bloom_filter<cthash::sha256_value>;
+
+	STATIC_REQUIRE(blocked::valid_parameters(22u, 26u));
+	STATIC_REQUIRE(!blocked::valid_parameters(22u, 27u));
+
+	const auto f = filter::for_capacity(1000000000u, 0.000001);
+	REQUIRE(filter::valid_parameters(30u, f.number_of_hashes()));
+}
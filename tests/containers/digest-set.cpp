@@ -0,0 +1,285 @@
+#include "../internal/support.hpp"
+#include <cthash/containers/digest-set.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/xxhash.hpp>
+#include <stdexcept>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+TEST_CASE("digest_set (constexpr)") {
+	constexpr bool result = [] {
+		cthash::digest_set<cthash::hash_value<8>> set{};
+
+		const bool first = set.insert(cthash::hash_value{"0011223344556677"});
+		const bool second = set.insert(cthash::hash_value{"8899aabbccddeeff"});
+		const bool again = set.insert(cthash::hash_value{"0011223344556677"});
+
+		return first && second && !again && set.size() == 2u && set.contains(cthash::hash_value{"8899aabbccddeeff"}) && !set.contains(cthash::hash_value{"8899aabbccddeefe"});
+	}();
+
+	STATIC_REQUIRE(result);
+}
+
+TEST_CASE("digest_set basics") {
+	cthash::digest_set<cthash::sha256_value> set{};
+
+	REQUIRE(set.empty());
+	REQUIRE(set.capacity() == 0u);
+	REQUIRE(!set.contains(digest_of<cthash::sha256>(0)));
+	REQUIRE(set.begin() == set.end());
+
+	for (size_t i = 0; i != 10000u; ++i) {
+		REQUIRE(set.insert(digest_of<cthash::sha256>(i)));
+	}
+
+	REQUIRE(set.size() == 10000u);
+	REQUIRE(set.capacity() >= 10000u);
+
+	for (size_t i = 0; i != 10000u; ++i) {
+		REQUIRE(!set.insert(digest_of<cthash::sha256>(i)));
+	}
+
+	REQUIRE(set.size() == 10000u);
+
+	for (size_t i = 0; i != 20000u; ++i) {
+		REQUIRE(set.contains(digest_of<cthash::sha256>(i)) == (i < 10000u));
+	}
+
+	REQUIRE(static_cast<size_t>(std::distance(set.begin(), set.end())) == set.size());
+
+	for (size_t i = 0; i < 10000u; i += 2u) {
+		REQUIRE(set.erase(digest_of<cthash::sha256>(i)));
+	}
+
+	REQUIRE(!set.erase(digest_of<cthash::sha256>(0)));
+	REQUIRE(set.size() == 5000u);
+
+	for (size_t i = 0; i != 10000u; ++i) {
+		REQUIRE(set.contains(digest_of<cthash::sha256>(i)) == (i % 2u == 1u));
+	}
+
+	const auto copy = set;
+	set.clear();
+
+	REQUIRE(set.empty());
+	REQUIRE(copy.size() == 5000u);
+	REQUIRE(copy.contains(digest_of<cthash::sha256>(1)));
+	REQUIRE(copy.find(digest_of<cthash::sha256>(3)) != copy.end());
+	REQUIRE(*copy.find(digest_of<cthash::sha256>(3)) == digest_of<cthash::sha256>(3));
+	REQUIRE(copy.find(digest_of<cthash::sha256>(2)) == copy.end());
+}
+
+TEST_CASE("digest_set with tombstones doesn't grow") {
+	cthash::digest_set<cthash::sha256_value> set{};
+	set.reserve(1000u);
+
+	const auto capacity = set.capacity();
+
+	for (size_t i = 0; i != 100000u; ++i) {
+		REQUIRE(set.insert(digest_of<cthash::sha256>(i)));
+		if (i >= 500u) {
+			REQUIRE(set.erase(digest_of<cthash::sha256>(i - 500u)));
+		}
+	}
+
+	REQUIRE(set.size() == 500u);
+	REQUIRE(set.capacity() == capacity);
+}
+
+TEST_CASE("digest_set bulk insert") {
+	std::vector<cthash::sha256_value> digests{};
+
+	for (size_t i = 0; i != 5000u; ++i) {
+		digests.push_back(digest_of<cthash::sha256>(i % 4000u));
+	}
+
+	cthash::digest_set<cthash::sha256_value> set{};
+	REQUIRE(set.insert(std::span<const cthash::sha256_value>(digests)) == 4000u);
+	REQUIRE(set.size() == 4000u);
+	REQUIRE(set.insert(std::span<const cthash::sha256_value>(digests)) == 0u);
+
+	for (const auto & d: digests) {
+		REQUIRE(set.contains(d));
+	}
+}
+
+TEST_CASE("digest_set with small digest") {
+	cthash::digest_set<cthash::xxhash32_value> set{"01234567"_xxh32, "89abcdef"_xxh32};
+
+	REQUIRE(set.size() == 2u);
+	REQUIRE(set.contains("01234567"_xxh32));
+	REQUIRE(!set.contains("01234566"_xxh32));
+}
+
+namespace {
+
+struct counted_xxh32 {
+	static inline size_t comparisons = 0u;
+
+	cthash::xxhash32_value value;
+
+	constexpr auto fingerprint() const noexcept {
+		return value.fingerprint();
+	}
+
+	friend bool operator==(const counted_xxh32 & lhs, const counted_xxh32 & rhs) noexcept {
+		++comparisons;
+		return lhs.value == rhs.value;
+	}
+};
+
+} // namespace
+
+TEST_CASE("digest_set with small digest compares only keys with matching H2") {
+	constexpr size_t n = 1000u;
+
+	cthash::digest_set<counted_xxh32> set{};
+	for (size_t i = 0; i != n; ++i) {
+		REQUIRE(set.insert(counted_xxh32{digest_of<cthash::xxhash32>(i)}));
+	}
+
+	counted_xxh32::comparisons = 0u;
+	for (size_t i = 0; i != n; ++i) {
+		REQUIRE(set.contains(counted_xxh32{digest_of<cthash::xxhash32>(i)}));
+	}
+
+	// one comparison for each found key, with 7 bits of H2 false positives are rare
+	REQUIRE(counted_xxh32::comparisons < n + n / 10u);
+}
+
+TEST_CASE("digest_map basics") {
+	cthash::digest_map<cthash::sha256_value, size_t> map{};
+
+	for (size_t i = 0; i != 1000u; ++i) {
+		const auto [it, success] = map.try_emplace(digest_of<cthash::sha256>(i), i);
+		REQUIRE(success);
+		REQUIRE(it->first == digest_of<cthash::sha256>(i));
+		REQUIRE(it->second == i);
+	}
+
+	REQUIRE(map.size() == 1000u);
+	REQUIRE(!map.try_emplace(digest_of<cthash::sha256>(5), 42u).second);
+	REQUIRE(map.find(digest_of<cthash::sha256>(5))->second == 5u);
+
+	REQUIRE(!map.insert_or_assign(digest_of<cthash::sha256>(5), 42u).second);
+	REQUIRE(map.find(digest_of<cthash::sha256>(5))->second == 42u);
+
+	map[digest_of<cthash::sha256>(6)] += 10u;
+	REQUIRE(map[digest_of<cthash::sha256>(6)] == 16u);
+	REQUIRE(map[digest_of<cthash::sha256>(2000)] == 0u);
+	REQUIRE(map.size() == 1001u);
+
+	std::vector<std::pair<cthash::sha256_value, size_t>> pairs{};
+	for (size_t i = 900; i != 1100u; ++i) {
+		pairs.emplace_back(digest_of<cthash::sha256>(i), i * 2u);
+	}
+
+	REQUIRE(map.insert(std::span<const std::pair<cthash::sha256_value, size_t>>(pairs)) == 100u);
+	REQUIRE(map.find(digest_of<cthash::sha256>(950))->second == 950u);
+	REQUIRE(map.find(digest_of<cthash::sha256>(1050))->second == 2100u);
+
+	size_t sum = 0;
+	for (const auto & [key, value]: map) {
+		REQUIRE(key != cthash::sha256_value{});
+		sum += 1u;
+	}
+	REQUIRE(sum == map.size());
+}
+
+namespace {
+
+// constructor throws for negative values, copies and moves throw when the shared budget is exhausted
+struct throwing_value {
+	static inline int alive = 0;
+	static inline int budget = -1;
+
+	int value;
+
+	static void spend() {
+		if (budget == 0) {
+			throw std::runtime_error{"budget exhausted"};
+		}
+		if (budget > 0) {
+			--budget;
+		}
+	}
+
+	throwing_value(int v): value{v} {
+		if (v < 0) {
+			throw std::runtime_error{"negative value"};
+		}
+		++alive;
+	}
+
+	throwing_value(const throwing_value & other): value{other.value} {
+		spend();
+		++alive;
+	}
+
+	throwing_value(throwing_value && other): value{other.value} {
+		spend();
+		++alive;
+	}
+
+	~throwing_value() noexcept {
+		--alive;
+	}
+};
+
+} // namespace
+
+TEST_CASE("digest_map with throwing mapped type") {
+	throwing_value::alive = 0;
+	throwing_value::budget = -1;
+
+	{
+		cthash::digest_map<cthash::sha256_value, throwing_value> map{};
+
+		for (int i = 0; i != 100; ++i) {
+			REQUIRE(map.try_emplace(digest_of<cthash::sha256>(static_cast<size_t>(i)), i).second);
+		}
+
+		// failed construction doesn't leave the key in the map
+		REQUIRE_THROWS(map.try_emplace(digest_of<cthash::sha256>(1000), -1));
+		REQUIRE(map.size() == 100u);
+		REQUIRE(!map.contains(digest_of<cthash::sha256>(1000)));
+		REQUIRE(static_cast<size_t>(std::distance(map.begin(), map.end())) == map.size());
+		REQUIRE(throwing_value::alive == 100);
+
+		REQUIRE(map.try_emplace(digest_of<cthash::sha256>(1000), 1000).second);
+		REQUIRE(map.find(digest_of<cthash::sha256>(1000))->second.value == 1000);
+
+		// failed copy releases only already copied values
+		throwing_value::budget = 50;
+		REQUIRE_THROWS([&] { const auto copy = map; }());
+		throwing_value::budget = -1;
+		REQUIRE(throwing_value::alive == 101);
+
+		// failed move during rehash keeps the map consistent and doesn't leak (only rehash moves values)
+		throwing_value::budget = 0;
+		const size_t capacity = map.capacity();
+		bool thrown = false;
+
+		for (size_t i = 0; !thrown && i != capacity; ++i) {
+			try {
+				map.try_emplace(digest_of<cthash::sha256>(2000u + i), 0);
+			} catch (const std::runtime_error &) {
+				thrown = true;
+			}
+		}
+
+		throwing_value::budget = -1;
+		REQUIRE(thrown);
+
+		REQUIRE(static_cast<size_t>(std::distance(map.begin(), map.end())) == map.size());
+		REQUIRE(throwing_value::alive == static_cast<int>(map.size()));
+
+		for (const auto & [key, value]: map) {
+			REQUIRE(map.find(key) != map.end());
+		}
+	}
+
+	REQUIRE(throwing_value::alive == 0);
+}
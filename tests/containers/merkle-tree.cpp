@@ -0,0 +1,141 @@
+#include "../internal/support.hpp"
+#include <cthash/containers/merkle-tree.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha3/keccak.hpp>
+#include <cthash/sha3/sha3-256.hpp>
+#include <string>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+namespace {
+
+auto numbered_leaves(size_t n) {
+	std::vector<std::string> output{};
+	output.reserve(n);
+	for (size_t i = 0; i != n; ++i) {
+		output.push_back(std::to_string(i));
+	}
+	return output;
+}
+
+template <typename Tree, typename Leaf> bool all_proofs_verify(const Tree & tree, std::span<const Leaf> leaves) {
+	for (size_t i = 0; i != leaves.size(); ++i) {
+		const auto proof = tree.proof(i);
+		if (!Tree::verify(Tree::hash_leaf(leaves[i]), i, tree.size(), proof, tree.root())) {
+			return false;
+		}
+	}
+	return true;
+}
+
+} // namespace
+
+TEST_CASE("merkle_tree rfc6962 (constexpr)") {
+	constexpr auto root = [] {
+		const auto leaves = std::array<std::string_view, 5>{"a", "b", "c", "d", "e"};
+		return cthash::merkle_tree<cthash::sha256>(std::span<const std::string_view>(leaves)).root();
+	}();
+
+	STATIC_REQUIRE(root == "fe14a5426fbd70c0fa73f52342afed0da0bd23c4838662ccf6b88a3070ead97b"_hash);
+}
+
+TEST_CASE("merkle_tree rfc6962 test vector") {
+	const auto leaves = std::vector<std::vector<std::byte>>{
+		{},
+		{std::byte{0x00}},
+		{std::byte{0x10}},
+		{std::byte{0x20}, std::byte{0x21}},
+		{std::byte{0x30}, std::byte{0x31}},
+		{std::byte{0x40}, std::byte{0x41}, std::byte{0x42}, std::byte{0x43}},
+		{std::byte{0x50}, std::byte{0x51}, std::byte{0x52}, std::byte{0x53}, std::byte{0x54}, std::byte{0x55}, std::byte{0x56}, std::byte{0x57}},
+		{std::byte{0x60}, std::byte{0x61}, std::byte{0x62}, std::byte{0x63}, std::byte{0x64}, std::byte{0x65}, std::byte{0x66}, std::byte{0x67}, std::byte{0x68}, std::byte{0x69}, std::byte{0x6a}, std::byte{0x6b}, std::byte{0x6c}, std::byte{0x6d}, std::byte{0x6e}, std::byte{0x6f}},
+	};
+
+	const auto tree = cthash::merkle_tree<cthash::sha256>(std::span<const std::vector<std::byte>>(leaves));
+
+	REQUIRE(tree.size() == 8u);
+	REQUIRE(tree.height() == 4u);
+	REQUIRE(tree.root() == "5dc9da79a70659a9ad559cb701ded9a2ab9d823aad2f4960cfe370eff4604328"_hash);
+	REQUIRE(all_proofs_verify(tree, std::span<const std::vector<std::byte>>(leaves)));
+}
+
+TEST_CASE("merkle_tree of empty input") {
+	const auto tree = cthash::merkle_tree<cthash::sha256>(std::span<const std::string_view>{});
+
+	REQUIRE(tree.size() == 0u);
+	REQUIRE(tree.root() == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"_hash);
+}
+
+TEST_CASE("merkle_tree with different hashers") {
+	const auto leaves = numbered_leaves(1000u);
+	const auto view = std::span<const std::string>(leaves);
+
+	const auto a = cthash::merkle_tree<cthash::sha256>(view);
+	REQUIRE(a.root() == "638afa98022925bacfddadb15ef22fd0199c1ac99c2973b6158243d13fce05c2"_hash);
+	REQUIRE(all_proofs_verify(a, view));
+
+	const auto b = cthash::merkle_tree<cthash::sha3_256>(view);
+	REQUIRE(b.root() == "fcfbc388291031f8aae1ad79b3ac6b5ea2d09dd0576d986baf816e1b20643fc7"_hash);
+	REQUIRE(all_proofs_verify(b, view));
+
+	const auto c = cthash::merkle_tree<cthash::keccak_256, cthash::no_prefixes>(view);
+	REQUIRE(c.root() == "fc0bdf832532d9d94510c8643720f63f22db9996f07965e1d1da9fb0d3fd7144"_hash);
+	REQUIRE(all_proofs_verify(c, view));
+}
+
+TEST_CASE("merkle_tree levels and odd nodes") {
+	const auto leaves = numbered_leaves(5u);
+	const auto tree = cthash::merkle_tree<cthash::sha256>(std::span<const std::string>(leaves));
+
+	REQUIRE(tree.height() == 4u);
+	REQUIRE(tree.level(0).size() == 5u);
+	REQUIRE(tree.level(1).size() == 3u);
+	REQUIRE(tree.level(2).size() == 2u);
+	REQUIRE(tree.level(3).size() == 1u);
+
+	// last leaf is promoted twice
+	REQUIRE(tree.level(1)[2] == tree.level(0)[4]);
+	REQUIRE(tree.level(2)[1] == tree.level(0)[4]);
+	REQUIRE(tree.level(1)[0] == decltype(tree)::hash_node(tree.level(0)[0], tree.level(0)[1]));
+
+	REQUIRE(tree.proof(4u).size() == 1u);
+	REQUIRE(tree.proof(0u).size() == 3u);
+}
+
+TEST_CASE("merkle_tree proof rejects wrong input") {
+	const auto leaves = numbered_leaves(11u);
+	const auto tree = cthash::merkle_tree<cthash::sha256>(std::span<const std::string>(leaves));
+	using tree_t = decltype(tree);
+
+	const auto proof = tree.proof(3u);
+	const auto leaf = tree_t::hash_leaf(leaves[3]);
+
+	REQUIRE(tree_t::verify(leaf, 3u, 11u, proof, tree.root()));
+	REQUIRE_FALSE(tree_t::verify(leaf, 2u, 11u, proof, tree.root()));
+	REQUIRE_FALSE(tree_t::verify(leaf, 3u, 4u, proof, tree.root()));
+	REQUIRE_FALSE(tree_t::verify(leaf, 11u, 11u, proof, tree.root()));
+	REQUIRE_FALSE(tree_t::verify(tree_t::hash_leaf(leaves[4]), 3u, 11u, proof, tree.root()));
+	REQUIRE_FALSE(tree_t::verify(leaf, 3u, 11u, std::span(proof).first(proof.size() - 1u), tree.root()));
+}
+
+TEST_CASE("merkle_tree over leaf hashes in multiple threads") {
+	const auto leaves = numbered_leaves(100000u);
+	const auto view = std::span<const std::string>(leaves);
+
+	std::vector<cthash::sha256_value> leaf_hashes{};
+	for (const auto & leaf: leaves) {
+		leaf_hashes.push_back(cthash::merkle_tree<cthash::sha256>::hash_leaf(leaf));
+	}
+
+	const auto single = cthash::merkle_tree<cthash::sha256>(view);
+	const auto parallel = cthash::merkle_tree<cthash::sha256>::from_leaf_hashes(leaf_hashes, 4u);
+
+	REQUIRE(single.root() == "68da32ef99ece5365f752ed80d9aec0715ac4766b2212d3511f7871f474e0c7f"_hash);
+	REQUIRE(parallel.root() == single.root());
+
+	for (size_t l = 0; l != single.height(); ++l) {
+		REQUIRE(std::ranges::equal(single.level(l), parallel.level(l)));
+	}
+}
@@ -0,0 +1,124 @@
+#include "../internal/support.hpp"
+#include <cthash/containers/mpt-root.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+using namespace std::string_view_literals;
+
+namespace {
+
+auto numbered_key(uint64_t i) {
+	std::array<std::byte, sizeof(uint64_t)> bytes;
+	for (size_t b = 0; b != bytes.size(); ++b) {
+		bytes[b] = static_cast<std::byte>(i >> (b * 8u));
+	}
+	return cthash::keccak_256{}.update(bytes).final();
+}
+
+auto numbered_value(uint64_t i, std::string_view tag) {
+	std::string output{};
+	for (size_t r = 0; r != (i % 5u + 1u); ++r) {
+		output += std::string(tag) + "-" + std::to_string(i);
+	}
+	return output;
+}
+
+} // namespace
+
+TEST_CASE("mpt_root of empty trie") {
+	auto trie = cthash::mpt_root{};
+
+	REQUIRE(trie.empty());
+	REQUIRE(trie.root() == "56e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421"_keccak_256);
+}
+
+TEST_CASE("mpt_root (constexpr)") {
+	constexpr auto root = [] {
+		auto trie = cthash::mpt_root{};
+		trie.insert("do"sv, "verb"sv).insert("dog"sv, "puppy"sv).insert("doge"sv, "coin"sv).insert("horse"sv, "stallion"sv);
+		return trie.root();
+	}();
+
+	STATIC_REQUIRE(root == "5991bb8c6514148a29db676a14ac506cd2cd5775ace63c30a4fe457715e9ac84"_keccak_256);
+}
+
+TEST_CASE("mpt_root ethereum test vectors") {
+	auto dogs = cthash::mpt_root{};
+	dogs.insert("doe"sv, "reindeer"sv).insert("dog"sv, "puppy"sv).insert("dogglesworth"sv, "cat"sv);
+	REQUIRE(dogs.size() == 3u);
+	REQUIRE(dogs.root() == "8aad789dff2f538bca5d8ea56e8abe10f4c7ba3a5dea95fea4cd6e7c3a1168d3"_keccak_256);
+
+	// root is hashed even when its encoding is shorter than a hash
+	auto small = cthash::mpt_root{};
+	small.insert(std::array<std::byte, 1>{std::byte{0x01}}, std::array<std::byte, 1>{std::byte{0x02}});
+	REQUIRE(small.root() == "40d0cb72098892560f0a6e349bdc55b80501978f965f1994d057086850adabb7"_keccak_256);
+}
+
+TEST_CASE("mpt_root erase and empty values") {
+	auto trie = cthash::mpt_root{};
+	trie.insert("do"sv, "verb"sv).insert("dog"sv, "puppy"sv).insert("doge"sv, "coin"sv).insert("horse"sv, "stallion"sv);
+	REQUIRE(trie.root() == "5991bb8c6514148a29db676a14ac506cd2cd5775ace63c30a4fe457715e9ac84"_keccak_256);
+
+	REQUIRE(trie.erase("doge"sv));
+	REQUIRE(!trie.erase("doge"sv));
+	REQUIRE(!trie.erase("d"sv));
+	REQUIRE(trie.size() == 3u);
+	REQUIRE(trie.root() == "40b4a841a5ed78d2beb33a3dbba6dd38f5b1566db97ae643e073ded3aa77dceb"_keccak_256);
+
+	// empty value is the same as erase
+	trie.insert("horse"sv, ""sv).insert("dog"sv, ""sv);
+	REQUIRE(trie.size() == 1u);
+	REQUIRE(trie.root() == "014f07ed95e2e028804d915e0dbd4ed451e394e1acfd29e463c11a060b2ddef7"_keccak_256);
+
+	trie.erase("do"sv);
+	REQUIRE(trie.empty());
+	REQUIRE(trie.root() == cthash::mpt_root::empty_root);
+}
+
+TEST_CASE("mpt_root incremental updates") {
+	constexpr size_t n = 1000u;
+
+	std::vector<cthash::keccak_256_value> keys{};
+	for (size_t i = 0; i != n; ++i) {
+		keys.push_back(numbered_key(i));
+	}
+
+	auto trie = cthash::mpt_root{};
+	for (size_t i = 0; i != n; ++i) {
+		trie.insert(keys[i], numbered_value(i, "value"));
+	}
+
+	REQUIRE(trie.size() == n);
+	REQUIRE(trie.root() == "a1fea1b03f10f1278f6d41b4ab0adc38a84947362163a77e8b6c1f6582cf812a"_keccak_256);
+
+	for (size_t i = 0; i < n; i += 3u) {
+		trie.insert(keys[i], numbered_value(i, "updated"));
+	}
+
+	REQUIRE(trie.size() == n);
+	REQUIRE(trie.root() == "6f10656da934a45087585c3f05330755867d9072636e58edefa3a1e095e825b1"_keccak_256);
+
+	for (size_t i = 0; i < n; i += 2u) {
+		REQUIRE(trie.erase(keys[i]));
+	}
+
+	const auto expected = "eb4ddc3de5063e4cad7393d1eaed25ded1fd064fdab6ea667c7e424ff1296ceb"_keccak_256;
+	REQUIRE(trie.size() == n / 2u);
+	REQUIRE(trie.root() == expected);
+
+	// same trie built from scratch
+	auto fresh = cthash::mpt_root{};
+	for (size_t i = 1; i < n; i += 2u) {
+		fresh.insert(keys[i], numbered_value(i, (i % 3u) ? "value" : "updated"));
+	}
+	REQUIRE(fresh.root() == expected);
+
+	trie.compact();
+	REQUIRE(trie.root() == expected);
+	trie.insert(keys[0], numbered_value(0, "value"));
+	trie.erase(keys[0]);
+	REQUIRE(trie.root() == expected);
+}
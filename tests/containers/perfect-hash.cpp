@@ -0,0 +1,92 @@
+#include "../internal/support.hpp"
+#include <cthash/containers/perfect-hash.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace std::string_view_literals;
+
+namespace {
+
+using keywords = cthash::static_map<"alignas", "alignof", "auto", "bool", "break", "case", "catch", "char", "class", "const", "constexpr", "continue", "default", "delete", "do", "double", "else", "enum", "explicit", "export", "extern", "false", "float", "for", "friend", "goto", "if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "nullptr", "operator", "private", "protected", "public", "return", "short", "signed", "sizeof", "static", "struct", "switch", "template", "this", "throw", "true", "try", "typedef", "typename", "union", "unsigned", "using", "virtual", "void", "volatile", "while">;
+
+constexpr auto classify(std::string_view token) noexcept -> int {
+	switch (keywords::find(token)) {
+	case keywords::index_of<"if">():
+	case keywords::index_of<"else">():
+	case keywords::index_of<"switch">(): return 1;
+	case keywords::index_of<"for">():
+	case keywords::index_of<"while">():
+	case keywords::index_of<"do">(): return 2;
+	case keywords::npos: return 0;
+	default: return 3;
+	}
+}
+
+} // namespace
+
+TEST_CASE("static_map (constexpr)") {
+	STATIC_REQUIRE(keywords::size() == 60u);
+	STATIC_REQUIRE(keywords::find("alignas") == 0u);
+	STATIC_REQUIRE(keywords::find("while") == 59u);
+	STATIC_REQUIRE(keywords::contains("constexpr"));
+	STATIC_REQUIRE(!keywords::contains("constexp"));
+	STATIC_REQUIRE(!keywords::contains("constexpr "));
+	STATIC_REQUIRE(!keywords::contains(""));
+
+	STATIC_REQUIRE(classify("if") == 1);
+	STATIC_REQUIRE(classify("while") == 2);
+	STATIC_REQUIRE(classify("return") == 3);
+	STATIC_REQUIRE(classify("identifier") == 0);
+}
+
+TEST_CASE("static_map finds all keys") {
+	for (size_t i = 0; i != keywords::size(); ++i) {
+		const auto key = std::string(keywords::keys[i]);
+		REQUIRE(keywords::find(key) == i);
+		REQUIRE(!keywords::contains(key + "_"));
+	}
+}
+
+TEST_CASE("perfect_hash_table with empty and single key") {
+	constexpr auto empty = cthash::perfect_hash_table<0>{std::array<std::string_view, 0>{}};
+	STATIC_REQUIRE(!empty.contains(""));
+	STATIC_REQUIRE(!empty.contains("hello"));
+
+	constexpr auto single = cthash::perfect_hash_table{std::array{""sv}};
+	STATIC_REQUIRE(single.find("") == 0u);
+	STATIC_REQUIRE(!single.contains("a"));
+}
+
+TEST_CASE("perfect_hash_table rejects duplicate keys") {
+	const auto with_duplicate = std::array{"a"sv, "b"sv, "a"sv};
+	REQUIRE_THROWS_AS(cthash::perfect_hash_table{with_duplicate}, std::invalid_argument);
+
+	const auto empty_twice = std::array{""sv, ""sv};
+	REQUIRE_THROWS_AS(cthash::perfect_hash_table{empty_twice}, std::invalid_argument);
+}
+
+TEST_CASE("perfect_hash_table with many keys") {
+	constexpr size_t n = 10000u;
+
+	std::vector<std::string> storage{};
+	for (size_t i = 0; i != n; ++i) {
+		storage.push_back("key-" + std::to_string(i * 7919u));
+	}
+
+	auto keys = std::make_unique<std::array<std::string_view, n>>();
+	for (size_t i = 0; i != n; ++i) {
+		(*keys)[i] = storage[i];
+	}
+
+	const auto table = std::make_unique<cthash::perfect_hash_table<n>>(*keys);
+	REQUIRE(table->size() == n);
+
+	for (size_t i = 0; i != n; ++i) {
+		REQUIRE(table->find(storage[i]) == i);
+		REQUIRE(!table->contains("key-" + std::to_string(i * 7919u + 1u)));
+	}
+}
@@ -0,0 +1,124 @@
+#include "../internal/support.hpp"
+#include <cthash/containers/sorted-digests.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/xxhash.hpp>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+namespace {
+
+auto digests(size_t n, size_t modulo) {
+	std::vector<cthash::sha256_value> output{};
+	output.reserve(n);
+	for (size_t i = 0; i != n; ++i) {
+		output.push_back(digest_of<cthash::sha256>(i % modulo));
+	}
+	return output;
+}
+
+} // namespace
+
+TEST_CASE("radix_sort (constexpr)") {
+	constexpr bool result = [] {
+		std::array<cthash::hash_value<4>, 5> values{cthash::hash_value{"ff000000"}, cthash::hash_value{"00ff0000"}, cthash::hash_value{"0000ff00"}, cthash::hash_value{"ff000001"}, cthash::hash_value{"00000000"}};
+		cthash::radix_sort(std::span(values));
+		return std::is_sorted(values.begin(), values.end());
+	}();
+
+	STATIC_REQUIRE(result);
+}
+
+TEST_CASE("radix_sort gives same order as std::sort") {
+	auto values = digests(50000u, 40000u);
+	auto expected = values;
+
+	std::sort(expected.begin(), expected.end());
+	cthash::radix_sort(std::span(values));
+
+	REQUIRE(values == expected);
+}
+
+TEST_CASE("radix_sort with common prefixes") {
+	std::vector<cthash::hash_value<8>> values{};
+	for (uint64_t i = 0; i != 5000u; ++i) {
+		cthash::hash_value<8> v{};
+		cthash::unwrap_bigendian_number<uint64_t>{std::span<std::byte, 8>(v)} = (i * 2654435761u) % 1000u;
+		values.push_back(v);
+	}
+
+	auto expected = values;
+	std::sort(expected.begin(), expected.end());
+	cthash::radix_sort(std::span(values));
+
+	REQUIRE(values == expected);
+}
+
+TEST_CASE("interpolation_lower_bound") {
+	auto values = digests(20000u, 15000u);
+	cthash::radix_sort(std::span(values));
+
+	const auto sorted = std::span<const cthash::sha256_value>(values);
+
+	for (size_t i = 0; i != 20000u; ++i) {
+		const auto key = digest_of<cthash::sha256>(i);
+		const auto expected = static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin());
+		REQUIRE(cthash::interpolation_lower_bound(sorted, key) == expected);
+	}
+
+	REQUIRE(cthash::interpolation_lower_bound(sorted, cthash::sha256_value{}) == 0u);
+	REQUIRE(cthash::interpolation_lower_bound(std::span<const cthash::sha256_value>{}, digest_of<cthash::sha256>(0)) == 0u);
+
+	auto max = cthash::sha256_value{};
+	std::fill(max.begin(), max.end(), std::byte{0xFF});
+	REQUIRE(cthash::interpolation_lower_bound(sorted, max) == sorted.size());
+}
+
+TEST_CASE("sorted_digests") {
+	const auto column = cthash::sorted_digests<cthash::sha256_value>(digests(10000u, 10000u));
+
+	REQUIRE(column.size() == 10000u);
+	REQUIRE(std::is_sorted(column.begin(), column.end()));
+
+	for (size_t i = 0; i != 20000u; ++i) {
+		REQUIRE(column.contains(digest_of<cthash::sha256>(i)) == (i < 10000u));
+	}
+}
+
+TEST_CASE("eytzinger_index") {
+	auto values = digests(12345u, 12345u);
+	cthash::radix_sort(std::span(values));
+
+	const auto index = cthash::eytzinger_index<cthash::sha256_value>(values);
+	REQUIRE(index.size() == values.size());
+
+	for (size_t i = 0; i != 20000u; ++i) {
+		const auto key = digest_of<cthash::sha256>(i);
+		const auto expected = std::lower_bound(values.begin(), values.end(), key);
+		const auto * result = index.lower_bound(key);
+
+		if (expected == values.end()) {
+			REQUIRE(result == nullptr);
+		} else {
+			REQUIRE(result != nullptr);
+			REQUIRE(*result == *expected);
+		}
+
+		REQUIRE(index.contains(key) == (i < 12345u));
+	}
+
+	const auto empty = cthash::eytzinger_index<cthash::sha256_value>{};
+	REQUIRE(empty.size() == 0u);
+	REQUIRE(empty.lower_bound(digest_of<cthash::sha256>(0)) == nullptr);
+}
+
+TEST_CASE("eytzinger_index (constexpr)") {
+	constexpr bool result = [] {
+		const std::array<cthash::hash_value<4>, 3> values{cthash::hash_value{"00000001"}, cthash::hash_value{"00000005"}, cthash::hash_value{"00000009"}};
+		const auto index = cthash::eytzinger_index<cthash::hash_value<4>>(values);
+		return index.contains(cthash::hash_value{"00000005"}) && !index.contains(cthash::hash_value{"00000006"}) && *index.lower_bound(cthash::hash_value{"00000006"}) == cthash::hash_value{"00000009"};
+	}();
+
+	STATIC_REQUIRE(result);
+}
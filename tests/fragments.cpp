@@ -0,0 +1,82 @@
+#include "internal/support.hpp"
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha2/sha512.hpp>
+#include <cthash/sha3/keccak.hpp>
+#include <cthash/sha3/sha3-256.hpp>
+#include <cthash/xxhash.hpp>
+#include <list>
+#include <string>
+#include <vector>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+namespace {
+
+// same layout as POSIX iovec
+struct io_vector {
+	void * iov_base;
+	size_t iov_len;
+};
+
+auto message(size_t n) {
+	std::string output(n, '\0');
+	for (size_t i = 0; i != n; ++i) {
+		output[i] = static_cast<char>('a' + (i * 7u) % 26u);
+	}
+	return output;
+}
+
+// split into fragments of various sizes (including empty ones)
+auto fragments_of(std::string_view in, size_t seed) {
+	std::vector<std::string_view> output{};
+	while (!in.empty()) {
+		seed = seed * 1103515245u + 12345u;
+		const size_t size = std::min(in.size(), (seed >> 8u) % 300u);
+		output.push_back(in.substr(0, size));
+		in = in.substr(size);
+	}
+	return output;
+}
+
+} // namespace
+
+TEST_CASE("update with fragments (constexpr)") {
+	constexpr auto v = [] {
+		const auto parts = std::array<std::string_view, 3>{"a", "", "bc"};
+		return cthash::sha256{}.update(parts).final();
+	}();
+
+	STATIC_REQUIRE(v == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"_sha256);
+}
+
+TEMPLATE_TEST_CASE("update with fragments is same as contiguous", "[fragments]", cthash::sha256, cthash::sha512, cthash::sha3_256, cthash::keccak_256, cthash::xxhash32, cthash::xxhash64) {
+	const auto input = message(5000u);
+	const auto expected = TestType{}.update(std::string_view(input)).final();
+
+	for (size_t seed = 1; seed != 20u; ++seed) {
+		const auto parts = fragments_of(input, seed);
+		REQUIRE(TestType{}.update(parts).final() == expected);
+	}
+
+	// iovec-like
+	std::string copy = input;
+	auto iov = std::vector<io_vector>{{copy.data(), 100u}, {copy.data() + 100, 0u}, {copy.data() + 100, 4000u}, {copy.data() + 4100, 900u}};
+	REQUIRE(TestType{}.update(std::span<const io_vector>(iov)).final() == expected);
+
+	// non-contiguous container of byte spans
+	auto list = std::list<std::span<const char>>{};
+	for (std::string_view part: fragments_of(input, 42u)) {
+		list.emplace_back(part.data(), part.size());
+	}
+	REQUIRE(TestType{}.update(list).final() == expected);
+}
+
+TEST_CASE("update with fragments after unaligned update") {
+	const auto input = message(1000u);
+	const auto parts = fragments_of(std::string_view(input).substr(3), 7u);
+
+	REQUIRE(cthash::sha256{}.update(std::string_view(input).substr(0, 3)).update(parts).final() == cthash::sha256{}.update(std::string_view(input)).final());
+	REQUIRE(cthash::sha3_256{}.update(std::string_view(input).substr(0, 3)).update(parts).final() == cthash::sha3_256{}.update(std::string_view(input)).final());
+}
@@ -0,0 +1,70 @@
+#include "internal/support.hpp"
+#include <cthash/hash-fixed.hpp>
+#include <cthash/sha2/sha224.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha2/sha384.hpp>
+#include <cthash/sha2/sha512.hpp>
+#include <cthash/sha3/keccak.hpp>
+#include <cthash/sha3/sha3-256.hpp>
+#include <cthash/sha3/sha3-512.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+namespace {
+
+template <size_t N> constexpr auto input_of_size() noexcept {
+	std::array<std::byte, N> output{};
+	for (size_t i = 0; i != N; ++i) {
+		output[i] = static_cast<std::byte>(i * 7u + 3u);
+	}
+	return output;
+}
+
+// compare with normal hashing for every size up to `Max`, to cover all padding layouts
+template <typename Hasher, size_t... N> constexpr bool same_as_update(std::index_sequence<N...>) noexcept {
+	return ((cthash::hash_fixed<Hasher>(input_of_size<N>()) == Hasher{}.update(input_of_size<N>()).final()) && ...);
+}
+
+} // namespace
+
+TEST_CASE("hash_fixed (constexpr)") {
+	constexpr auto v = cthash::hash_fixed<cthash::sha256>(std::span<const char, 3>("abc", 3u));
+	STATIC_REQUIRE(v == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"_sha256);
+
+	// around boundaries of padding layouts
+	STATIC_REQUIRE(same_as_update<cthash::sha256>(std::index_sequence<0, 1, 32, 55, 56, 63, 64, 65, 119, 120, 128>()));
+	STATIC_REQUIRE(same_as_update<cthash::sha3_256>(std::index_sequence<0, 1, 32, 135, 136, 137>()));
+}
+
+TEMPLATE_TEST_CASE("hash_fixed same as update", "[hash-fixed]", cthash::sha224, cthash::sha256, cthash::sha384, cthash::sha512, cthash::sha3_256, cthash::sha3_512, cthash::keccak_256) {
+	// boundaries of blocks and padding for 64/128 byte blocks and all sha-3 rates
+	REQUIRE(same_as_update<TestType>(std::index_sequence<0, 1, 2, 3, 4, 5, 31, 32, 33, 55, 56, 57, 60, 61, 63, 64, 65, 71, 72, 73, 103, 104, 105, 111, 112, 113, 127, 128, 129, 135, 136, 137, 143, 144, 145, 239, 240, 256, 257>()));
+}
+
+TEST_CASE("hash_fixed of digest") {
+	const auto digest = cthash::sha256{}.update("hello").final();
+
+	REQUIRE(cthash::hash_fixed<cthash::sha256>(digest) == cthash::sha256{}.update(digest).final());
+	REQUIRE(cthash::hash_fixed<cthash::keccak_256>(digest) == cthash::keccak_256{}.update(digest).final());
+
+	auto node = std::array<std::byte, 64>{};
+	std::copy(digest.begin(), digest.end(), node.begin());
+	std::copy(digest.begin(), digest.end(), node.begin() + 32);
+
+	REQUIRE(cthash::hash_fixed<cthash::sha256>(std::span(node)) == cthash::sha256{}.update(node).final());
+}
+
+TEMPLATE_TEST_CASE("hash_fixed_lanes same as hash_fixed", "[hash-fixed]", cthash::sha256, cthash::sha512, cthash::keccak_256) {
+	std::array<std::array<std::byte, 65>, 4> inputs{};
+	for (size_t l = 0; l != inputs.size(); ++l) {
+		inputs[l].fill(static_cast<std::byte>(l * 7u));
+	}
+
+	const auto results = cthash::hash_fixed_lanes<TestType>(std::array{std::span<const std::byte, 65>(inputs[0]), std::span<const std::byte, 65>(inputs[1]), std::span<const std::byte, 65>(inputs[2]), std::span<const std::byte, 65>(inputs[3])});
+
+	for (size_t l = 0; l != inputs.size(); ++l) {
+		REQUIRE(results[l] == cthash::hash_fixed<TestType>(inputs[l]));
+	}
+}
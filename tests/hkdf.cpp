@@ -0,0 +1,32 @@
+#include "internal/support.hpp"
+#include <cthash/hkdf.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha2/sha512.hpp>
+#include <cthash/sha3/sha3-256.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("hkdf-sha256 (rfc 5869, test case 1)") {
+	constexpr auto ikm = array_of<22>(std::byte{0x0b});
+	constexpr auto salt = std::array<std::byte, 13>{std::byte{0x00}, std::byte{0x01}, std::byte{0x02}, std::byte{0x03}, std::byte{0x04}, std::byte{0x05}, std::byte{0x06}, std::byte{0x07}, std::byte{0x08}, std::byte{0x09}, std::byte{0x0a}, std::byte{0x0b}, std::byte{0x0c}};
+	constexpr auto info = std::array<std::byte, 10>{std::byte{0xf0}, std::byte{0xf1}, std::byte{0xf2}, std::byte{0xf3}, std::byte{0xf4}, std::byte{0xf5}, std::byte{0xf6}, std::byte{0xf7}, std::byte{0xf8}, std::byte{0xf9}};
+
+	constexpr auto prk = cthash::hkdf_extract<cthash::sha256>(salt, ikm);
+	STATIC_REQUIRE(prk == cthash::hash_value{"077709362c2e32df0ddc3f0dc47bba6390b6c73bb50f9c3122ec844ad7c2b3e5"});
+
+	constexpr auto okm = cthash::hkdf_expand<cthash::sha256, 42>(prk, info);
+	STATIC_REQUIRE(okm == cthash::hash_value{"3cb25f25faacd57a90434f64d0362f2a2d2d0a90cf1a5a4c5db02d56ecc4c5bf34007208d5b887185865"});
+
+	STATIC_REQUIRE(cthash::hkdf<cthash::sha256, 42>(ikm, salt, info) == okm);
+}
+
+TEST_CASE("hkdf-sha256 (rfc 5869, test case 3)") {
+	const auto ikm = array_of<22>(std::byte{0x0b});
+
+	REQUIRE(cthash::hkdf_extract<cthash::sha256>("", ikm) == cthash::hash_value{"19ef24a32c717b167f33a91d6f648bdf96596776afdb6377ac434c1c293ccb04"});
+	REQUIRE(cthash::hkdf<cthash::sha256, 42>(ikm, "", "") == cthash::hash_value{"8da4e775a563c18f715f802a063c5a31b8a11f5c5ee1879ec3454e5f3c738d2d9d201395faa4b61a96c8"});
+}
+
+TEST_CASE("hkdf with other hashers") {
+	REQUIRE(cthash::hkdf<cthash::sha512, 100>(std::string_view{"input key"}, std::string_view{"salt"}, std::string_view{"context"}) == cthash::hash_value{"ca79a0e1a31534845000eab61e6b9e7eb42e25edaae6274ab6151fa9389c05f590fedaf723865ba95bb13b253fb9f4e34fb7e1aad2a4612956d04393fd385bb629203511c4ef998df17b8da2d517974144591eb5525ee5c55d078efc5cd1a0ddb941fc05"});
+	REQUIRE(cthash::hkdf<cthash::sha3_256, 50>(std::string_view{"input key"}, std::string_view{"salt"}, std::string_view{"context"}) == cthash::hash_value{"f18a0ad90f74ecb76ba74cbe6b50d4b1da5658639625edc72a6047af0b1996b8f58b819b471e8fed4815acf6ecbacfb4b0a6"});
+}
@@ -0,0 +1,61 @@
+#include "internal/support.hpp"
+#include <cthash/hmac.hpp>
+#include <cthash/sha2/sha224.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha2/sha384.hpp>
+#include <cthash/sha2/sha512.hpp>
+#include <cthash/sha3/sha3-256.hpp>
+#include <cthash/sha3/sha3-512.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+TEST_CASE("hmac-sha256 (constexpr)") {
+	constexpr auto v1 = cthash::hmac<cthash::sha256>{"key"}.update("The quick brown fox jumps over the lazy dog").final();
+	STATIC_REQUIRE(v1 == cthash::hash_value{"f7bc83f430538424b13298e6aa6fb143ef4d59a14946175997479dbc2d1a3cd8"});
+
+	constexpr auto key = cthash::hmac_key<cthash::sha256>{"key"};
+	constexpr auto v2 = key.calculate("The quick brown fox jumps over the lazy dog");
+	STATIC_REQUIRE(v1 == v2);
+}
+
+TEST_CASE("hmac-sha256") {
+	const auto key = cthash::hmac_key<cthash::sha256>{std::string_view{"key"}};
+	auto h = cthash::hmac{key};
+	h.update(std::string_view{"The quick brown fox "});
+	h.update(std::string_view{"jumps over the lazy dog"});
+	const auto v = h.final();
+
+	STATIC_REQUIRE(std::same_as<decltype(v), const cthash::tagged_hash_value<cthash::hmac_tag<cthash::sha256>>>);
+	REQUIRE(v == cthash::hash_value{"f7bc83f430538424b13298e6aa6fb143ef4d59a14946175997479dbc2d1a3cd8"});
+	REQUIRE(cthash::simple<cthash::hmac<cthash::sha256>>(std::string_view{"The quick brown fox jumps over the lazy dog"}, key) == v);
+}
+
+TEST_CASE("hmac with key longer than block") {
+	const auto key = array_of<131>(std::byte{0xaa});
+	const auto message = std::string_view{"Test Using Larger Than Block-Size Key - Hash Key First"};
+
+	REQUIRE(cthash::hmac<cthash::sha224>{key}.update(message).final() == cthash::hash_value{"95e9a0db962095adaebe9b2d6f0dbce2d499f112f2d2b7273fa6870e"});
+	REQUIRE(cthash::hmac<cthash::sha256>{key}.update(message).final() == cthash::hash_value{"60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54"});
+
+	// sha3-256 rate is 136 bytes
+	const auto long_key = array_of<200>(std::byte{0xaa});
+	REQUIRE(cthash::hmac<cthash::sha3_256>{long_key}.update(message).final() == cthash::hash_value{"49ad92b02124fdac9627ae45e008a696182ab6bfb8470457777c744aeb9df06f"});
+}
+
+TEST_CASE("hmac with other hashers") {
+	const auto message = std::string_view{"The quick brown fox jumps over the lazy dog"};
+
+	REQUIRE(cthash::hmac<cthash::sha512>{"key"}.update(message).final() == cthash::hash_value{"b42af09057bac1e2d41708e48a902e09b5ff7f12ab428a4fe86653c73dd248fb82f948a549f7b791a5b41915ee4d1ec3935357e4e2317250d0372afa2ebeeb3a"});
+	REQUIRE(cthash::hmac<cthash::sha3_256>{"key"}.update(message).final() == cthash::hash_value{"8c6e0683409427f8931711b10ca92a506eb1fafa48fadd66d76126f47ac2c333"});
+	REQUIRE(cthash::hmac<cthash::sha384>{""}.update("").final() == cthash::hash_value{"6c1f2ee938fad2e24bd91298474382ca218c75db3d83e114b3d4367776d14d3551289e75e8209cd4b792302840234adc"});
+	REQUIRE(cthash::hmac<cthash::sha3_512>{"Jefe"}.update("what do ya want for nothing?").final() == cthash::hash_value{"5a4bfeab6166427c7a3647b747292b8384537cdb89afb3bf5665e4c5e709350b287baec921fd7ca0ee7a0c31d022a95e1fc92ba9d77df883960275beb4e62024"});
+}
+
+TEST_CASE("hmac verification") {
+	const auto key = cthash::hmac_key<cthash::sha256>{"secret"};
+	const auto mac = key.calculate(std::string_view{"message"});
+
+	REQUIRE(cthash::constant_time_equal(mac, key.calculate(std::string_view{"message"})));
+	REQUIRE(!cthash::constant_time_equal(mac, key.calculate(std::string_view{"massage"})));
+}
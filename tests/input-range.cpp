@@ -0,0 +1,57 @@
+#include "internal/support.hpp"
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha2/sha512.hpp>
+#include <cthash/sha3/keccak.hpp>
+#include <cthash/sha3/sha3-256.hpp>
+#include <cthash/xxhash.hpp>
+#include <iterator>
+#include <list>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+namespace {
+
+auto message(size_t n) {
+	std::string output(n, '\0');
+	for (size_t i = 0; i != n; ++i) {
+		output[i] = static_cast<char>('a' + (i * 7u) % 26u);
+	}
+	return output;
+}
+
+} // namespace
+
+TEST_CASE("update with input range (constexpr)") {
+	constexpr auto v = [] {
+		return cthash::sha256{}.update(std::views::iota(0, 3) | std::views::transform([](int i) { return static_cast<char>('a' + i); })).final();
+	}();
+
+	STATIC_REQUIRE(v == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"_sha256);
+}
+
+TEMPLATE_TEST_CASE("update with input range is same as span", "[input-range]", cthash::sha256, cthash::sha512, cthash::sha3_256, cthash::keccak_256, cthash::xxhash32, cthash::xxhash64) {
+	for (size_t n: {0u, 1u, 63u, 64u, 65u, 135u, 136u, 137u, 1000u, 5000u}) {
+		const auto input = message(n);
+		const auto expected = TestType{}.update(std::string_view(input)).final();
+
+		// transformed view (random access, sized)
+		REQUIRE(TestType{}.update(input | std::views::transform([](char c) { return static_cast<std::byte>(c); })).final() == expected);
+
+		// bidirectional container
+		const auto list = std::list<char>(input.begin(), input.end());
+		REQUIRE(TestType{}.update(list).final() == expected);
+
+		// single pass stream without size
+		auto stream = std::istringstream{input};
+		REQUIRE(TestType{}.update(std::ranges::subrange(std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{})).final() == expected);
+
+		// mixed with span updates
+		auto split = std::string_view(input).substr(0, n / 3u);
+		REQUIRE(TestType{}.update(split).update(std::string_view(input).substr(n / 3u) | std::views::filter([](char) { return true; })).final() == expected);
+	}
+}
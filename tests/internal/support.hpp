@@ -5,7 +5,9 @@
 #include <span>
 #include <string>
 #include <string_view>
+#include <vector>
 #include <cstddef>
+#include <cstdint>
 
 template <typename T> const auto & runtime_pass(const T & val) {
 	return val;
@@ -25,6 +27,38 @@ template <size_t N, typename T = std::byte> consteval auto array_of_zeros() {
 	return array_of<N, T>(T{0});
 }
 
+// bytes first, first + step, ... (eg. inputs and keys of NIST samples)
+template <size_t N> constexpr auto counting_bytes(size_t first = 0u, size_t step = 1u) {
+	std::array<std::byte, N> output;
+	for (size_t i = 0; i != N; ++i) {
+		output[i] = static_cast<std::byte>(first + i * step);
+	}
+	return output;
+}
+
+// digest of a number (in native byte order) as a fixture of distinct digests
+template <typename Hasher> auto digest_of(size_t i) noexcept {
+	const auto number = static_cast<uint64_t>(i);
+	return Hasher{}.update(std::span<const std::byte>(reinterpret_cast<const std::byte *>(&number), sizeof(number))).final();
+}
+
+// digests of numbers [0, count)
+template <typename Hasher> auto digests_of(size_t count) {
+	std::vector<decltype(digest_of<Hasher>(0u))> output{};
+	output.reserve(count);
+	for (size_t i = 0; i != count; ++i) {
+		output.push_back(digest_of<Hasher>(i));
+	}
+	return output;
+}
+
+// result of `builder` is created on first use and kept for the rest of the run (so benchmark fixtures are not built
+// when benchmarks are skipped), each builder (lambda) has its own value, so it must not capture anything
+template <typename Builder> const auto & lazy_fixture(Builder builder) {
+	static const auto output = builder();
+	return output;
+}
+
 template <size_t N> constexpr auto to_sv(const std::array<char, N> & in) {
 	return std::string_view{in.data(), in.size()};
 }
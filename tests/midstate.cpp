@@ -0,0 +1,141 @@
+#include "internal/support.hpp"
+#include <cthash/sha2/sha224.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha2/sha512.hpp>
+#include <cthash/sha3/keccak.hpp>
+#include <cthash/sha3/sha3-256.hpp>
+#include <cthash/sha3/shake128.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+TEMPLATE_TEST_CASE("export/import state roundtrip", "[midstate]", cthash::sha224, cthash::sha256, cthash::sha512, cthash::sha3_256, cthash::keccak_256) {
+	const auto message = std::string_view{"the quick brown fox jumps over the lazy dog, again and again and again and again and again and again and again"};
+	const auto expected = TestType{}.update(message).final();
+
+	// split at every position so block is exported with every possible fill
+	for (size_t i = 0; i <= message.size(); ++i) {
+		auto h = TestType{};
+		h.update(message.substr(0, i));
+
+		const auto state = h.export_state();
+		STATIC_REQUIRE(state.size() == TestType::exported_state_size);
+
+		auto restored = TestType::import_state(state);
+		REQUIRE(restored.has_value());
+		REQUIRE(restored->export_state() == state);
+
+		restored->update(message.substr(i));
+		REQUIRE(restored->final() == expected);
+	}
+}
+
+TEST_CASE("export/import state (constexpr)") {
+	constexpr auto result = [] {
+		auto h = cthash::sha256{};
+		h.update("hello ");
+		auto restored = cthash::sha256::import_state(h.export_state());
+		return restored->update("world").final();
+	}();
+
+	STATIC_REQUIRE(result == "b94d27b9934d3e08a52e52d7da7dabfac484efe37a5380ee9088f7ace2efcde9"_sha256);
+}
+
+TEST_CASE("export state format") {
+	auto h = cthash::sha256{};
+	h.update("abc");
+	const auto state = h.export_state();
+
+	REQUIRE(state.size() == 32u + 32u + 8u + 64u);
+	REQUIRE(state[0] == std::byte{'c'});
+	REQUIRE(state[7] == std::byte{'e'});
+	REQUIRE(state[8] == std::byte{1});			   // version
+	REQUIRE(state[16] == std::byte{32});		   // digest length
+	REQUIRE(state[20] == std::byte{64});		   // block size
+	REQUIRE(state[32] == std::byte{0x67});		   // first state word (little-endian)
+	REQUIRE(state[32 + 32] == std::byte{3});	   // total length
+	REQUIRE(state[32 + 32 + 8] == std::byte{'a'}); // block
+	REQUIRE(state[32 + 32 + 8 + 3] == std::byte{0});
+
+	const auto kstate = cthash::sha3_256{}.export_state();
+	REQUIRE(kstate.size() == 32u + 200u + 8u);
+	REQUIRE(kstate[12] == std::byte{1});	// family
+	REQUIRE(kstate[20] == std::byte{136});	// rate
+	REQUIRE(kstate[24] == std::byte{0x06}); // suffix
+}
+
+TEST_CASE("import state rejects invalid input") {
+	auto state = cthash::sha256{}.update("abc").export_state();
+
+	// different algorithms with same layout
+	REQUIRE_FALSE(cthash::sha224::import_state(state).has_value());
+	REQUIRE_FALSE(cthash::sha512::import_state(state).has_value());
+	REQUIRE_FALSE(cthash::keccak_256::import_state(cthash::sha3_256{}.export_state()).has_value());
+
+	// truncated
+	REQUIRE_FALSE(cthash::sha256::import_state(std::span<const std::byte>(state).first(state.size() - 1u)).has_value());
+
+	// unknown version
+	auto other_version = state;
+	other_version[8] = std::byte{2};
+	REQUIRE_FALSE(cthash::sha256::import_state(other_version).has_value());
+
+	// broken magic
+	auto broken = state;
+	broken[0] = std::byte{'x'};
+	REQUIRE_FALSE(cthash::sha256::import_state(broken).has_value());
+
+	// position outside of rate
+	auto kstate = cthash::sha3_256{}.export_state();
+	kstate[32 + 200] = std::byte{136};
+	REQUIRE_FALSE(cthash::sha3_256::import_state(kstate).has_value());
+}
+
+TEST_CASE("prefixed_hasher") {
+	const auto prefix = std::string_view{"domain separation tag which is longer than one block of sha-256 and so it's processed only once"};
+	const auto ph = cthash::prefixed_hasher<cthash::sha256>{prefix};
+
+	for (std::string_view message: {"", "a", "hello world"}) {
+		const auto expected = cthash::sha256{}.update(prefix).update(message).final();
+		REQUIRE(ph.calculate(message) == expected);
+		REQUIRE(ph.start().update(message).final() == expected);
+	}
+
+	// resume from checkpoint
+	const auto restored = cthash::prefixed_hasher<cthash::sha256>::import_state(ph.export_state());
+	REQUIRE(restored.has_value());
+	REQUIRE(restored->calculate(std::string_view{"hello world"}) == ph.calculate(std::string_view{"hello world"}));
+
+	// XOF
+	const auto xof = cthash::prefixed_hasher<cthash::shake128>{prefix};
+	REQUIRE(xof.start().update("abc").final<256>() == cthash::shake128{}.update(prefix).update("abc").final<256>());
+}
+
+TEST_CASE("prefixed_hasher (constexpr)") {
+	constexpr auto ph = cthash::prefixed_hasher<cthash::sha3_256>{"hello "};
+	constexpr auto result = ph.calculate("world");
+
+	STATIC_REQUIRE(result == cthash::sha3_256{}.update("hello world").final());
+}
+
+TEMPLATE_TEST_CASE("with_prefix", "[midstate]", cthash::sha256, cthash::sha512, cthash::sha3_256) {
+	// prefix longer than a block of any of these, so part is compressed and part stays in buffer
+	using hasher_t = cthash::with_prefix<TestType, "this prefix is long enough to fill more than one block of sha-256 and also of sha3-256 and sha-512 hashers, to test both parts of the midstate">;
+
+	const auto prefix = std::string_view{hasher_t::prefix};
+	for (std::string_view message: {"", "a", "hello world"}) {
+		const auto expected = TestType{}.update(prefix).update(message).final();
+		REQUIRE(hasher_t{}.update(message).final() == expected);
+		REQUIRE(cthash::simple<hasher_t>(message) == expected);
+	}
+}
+
+TEST_CASE("with_prefix (constexpr)") {
+	// "blob <size>\0" header of git objects
+	using git_blob = cthash::with_prefix<cthash::sha256, "blob 5\0">;
+	constexpr auto result = git_blob{}.update("hello").final();
+
+	STATIC_REQUIRE(git_blob{}.size() == 7u);
+	STATIC_REQUIRE(result == cthash::sha256{}.update(std::string_view{"blob 5\0hello", 12u}).final());
+}
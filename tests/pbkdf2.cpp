@@ -0,0 +1,57 @@
+#include "internal/support.hpp"
+#include <cthash/pbkdf2.hpp>
+#include <cthash/sha2/sha224.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha2/sha384.hpp>
+#include <cthash/sha2/sha512.hpp>
+#include <cthash/sha2/sha512/t.hpp>
+#include <cthash/sha3/sha3-256.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("pbkdf2-hmac-sha256 (constexpr)") {
+	constexpr auto v1 = cthash::pbkdf2<cthash::sha256>("password", "salt", 1u);
+	STATIC_REQUIRE(v1 == cthash::hash_value{"120fb6cffcf8b32c43e7225256c4f837a86548c92ccc35480805987cb70be17b"});
+
+	constexpr auto v2 = cthash::pbkdf2<cthash::sha256>("password", "salt", 2u);
+	STATIC_REQUIRE(v2 == cthash::hash_value{"ae4d0c95af6b46d32d0adff928f06dd02a303f8ef3c251dfd6e2d85a95474c43"});
+}
+
+TEST_CASE("pbkdf2-hmac-sha256") {
+	REQUIRE(cthash::pbkdf2<cthash::sha256>(std::string_view{"password"}, std::string_view{"salt"}, 4096u) == cthash::hash_value{"c5e478d59288c841aa530db6845c4c8d962893a001ce4e11a4963873aa98134a"});
+
+	// output longer than digest, second block is truncated
+	REQUIRE(cthash::pbkdf2<cthash::sha256, 40>(std::string_view{"passwordPASSWORDpassword"}, std::string_view{"saltSALTsaltSALTsaltSALTsaltSALTsalt"}, 4096u) == cthash::hash_value{"348c89dbcbd32b2f32d814b8116e84cf2b17347ebc1800181c4e2a1fb8dd53e1c635518c7dac47e9"});
+
+	// enough output blocks to fill all lanes and some more
+	REQUIRE(cthash::pbkdf2<cthash::sha256, 300>("password", "salt", 1000u) == cthash::hash_value{"632c2812e46d4604102ba7618e9d6d7d2f8128f6266b4a03264d2a0460b7dcb388b3b1131f741bcbeb02541c8c2e97bd8bed62ab6425542e45512b7312f440ebc6e21f4356a5edf32cf0394e0d5be940e0e930cfe21e38a3ff94e28d26c23fac7701ac92f52ade33aad5663b057526d66c32f2239c65e5510f3bb57cb914f1e0e051605dce56d911c8ddfcea6105cb8f2fa3a498869755684b795bd72bfc63bca27020c5b81cb2adaf3e16435b6d20d1fd1446902511e7a8a25aa7dfaf115a62ecbfc63656ac3de0a23c1aa3c25c88ed1977080ce2d708cf010881038afa103097e44444cb014d9fd4971c69a8d4ca1e2e28af068b7f7149a167da64d066727a8f815f430b7c4023bbcf6a3b4ec5a1f400d2591a884eda4e4b2335460221d3f2ba880518da245762ce92a5c7"});
+
+	// password longer than block
+	REQUIRE(cthash::pbkdf2<cthash::sha256>(std::string(100u, 'p'), "salt", 1000u) == cthash::hash_value{"bc3c380bc1b4894e735f9d8b225e3404d32fd14479124e912eb2ba5e2462fb22"});
+}
+
+TEST_CASE("pbkdf2 with other hashers") {
+	REQUIRE(cthash::pbkdf2<cthash::sha224>("password", "salt", 1000u) == cthash::hash_value{"d3bcf320fd918908eafcaa460faf40e201f6508d4e6f3d9c1c0abd30"});
+	REQUIRE(cthash::pbkdf2<cthash::sha384>("password", "salt", 1000u) == cthash::hash_value{"3bd37e2236941d4a77b1b5b714c6f913fabb6b0841a6d7d8656b99d611e900fe06edb93b5b809efaa9678b635ce513e0"});
+	REQUIRE(cthash::pbkdf2<cthash::sha512>("password", "salt", 1000u) == cthash::hash_value{"afe6c5530785b6cc6b1c6453384731bd5ee432ee549fd42fb6695779ad8a1c5bf59de69c48f774efc4007d5298f9033c0241d5ab69305e7b64eceeb8d834cfec"});
+	REQUIRE(cthash::pbkdf2<cthash::sha512, 300>("password", "salt", 100u) == cthash::hash_value{"fef7276b107040a0a713bcbec9fd3e191cc6153249e245a3e1a22087dbe616060bbfc8411c6363f3c10ab5d02a56c38e2066a4e205b0ca8f959fd731e5fa584b8543d1dd32a079358f54f31e0e44063c34e75019d90714fc3ed4a9425a591b2a448e53bb360bac79dad5f96ded0bce5b127cd7fcca2ef74d14f9f5fc27f0e191bce435f523a042fe5bdfa810eb256eca2e39b3ec26ba0202805fd851611e83c57feadc167a54342c3edb672fc3f32e94974a888a582179d63a48b647be13412c95e96ae7b78ef564d95d8a8ac0105c270c95e23a26c96bad1c38d013dde537e6336b700149f6307cd531c4096bcbe4feaf9d9af50f9bd3eb8fda8ebdb25987de588f71361934703c151766a67d0818d17ad8a8dc7cbfed8c576c92a7c9f3f9c1be7f8930115d1d4656f61af1"});
+
+	// these go through generic HMAC path
+	REQUIRE(cthash::pbkdf2<cthash::sha512t<224>, 40>("password", "salt", 100u) == cthash::hash_value{"954b4da75a1bfd685efe6fd8629bc1fee8500c55bac38bf66a0ea05af18022b197d87913b90feeca"});
+	REQUIRE(cthash::pbkdf2<cthash::sha3_256, 40>("password", "salt", 100u) == cthash::hash_value{"3662b9455cde6979b1d5d866df806e1fe15954073e07c7c2acf2c80205074e46d2226ae0253297f8"});
+}
+
+TEST_CASE("pbkdf2 batch of passwords") {
+	const auto passwords = std::array<std::string_view, 4>{"alpha", "bravo", "charlie", "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"};
+	const auto result = cthash::pbkdf2_batch<cthash::sha256>(passwords, "salt", 1000u);
+
+	REQUIRE(result[0] == cthash::hash_value{"fefca56cbe1d1eb80660ae32b6f1c1710bf789392278393fd991a29ffa8827ad"});
+	REQUIRE(result[1] == cthash::hash_value{"147c7959b52a0b68c79e134c0672b730e46d9200cdce7761fad1910de71b851e"});
+	REQUIRE(result[2] == cthash::hash_value{"3dd1f0464b1717ecdc9b7b251e8556d597efc0a28fa60bcc1e3cd390599dc076"});
+	REQUIRE(result[3] == cthash::hash_value{"afc5c595f05f2cd6c1ddd7bc2628ea4c5df74508996952bb4864d4047eae2500"});
+
+	// same result as one by one
+	const auto longer = cthash::pbkdf2_batch<cthash::sha512, 100>(passwords, "salt", 10u);
+	for (size_t i = 0; i != passwords.size(); ++i) {
+		REQUIRE(longer[i] == cthash::pbkdf2<cthash::sha512, 100>(passwords[i], "salt", 10u));
+	}
+}
@@ -0,0 +1,62 @@
+#include "internal/support.hpp"
+#include <cthash/midstate.hpp>
+#include <cthash/sha2/sha256.hpp>
+#include <cthash/sha2/sha256d.hpp>
+#include <cthash/sha2/sha512.hpp>
+#include <cthash/sha3/keccak.hpp>
+#include <cthash/sha3/sha3-256.hpp>
+#include <cthash/xxhash.hpp>
+#include <string>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+TEST_CASE("reset (constexpr)") {
+	constexpr auto v = [] {
+		auto h = cthash::sha256{};
+		h.update("something else");
+		return h.reset().update("abc").final();
+	}();
+
+	STATIC_REQUIRE(v == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"_sha256);
+}
+
+TEMPLATE_TEST_CASE("hash_into is same as new hasher", "[reset]", cthash::sha256, cthash::sha512, cthash::sha256d, cthash::sha3_256, cthash::keccak_256, cthash::xxhash32, cthash::xxhash64) {
+	auto h = TestType{};
+
+	for (size_t n: {0u, 3u, 100u, 200u, 1000u}) {
+		const auto input = std::string(n, 'x');
+		const auto expected = TestType{}.update(std::string_view(input)).final();
+
+		auto output = decltype(expected){};
+		h.update(std::string_view(input)).hash_into(output);
+		REQUIRE(output == expected);
+	}
+
+	// reset in middle of message
+	h.update("lorem ipsum").reset();
+	REQUIRE(h.update("abc").final() == TestType{}.update("abc").final());
+}
+
+TEST_CASE("xxhash reset with seed") {
+	auto h = cthash::xxhash64{1u};
+	h.update("something");
+
+	REQUIRE(h.reset(42u).update("abc").final() == cthash::xxhash64{42u}.update("abc").final());
+	REQUIRE(h.reset().update("abc").final() == cthash::xxhash64{42u}.update("abc").final());
+}
+
+TEST_CASE("with_prefix reset goes back to midstate") {
+	using hasher_t = cthash::with_prefix<cthash::sha256, "prefix:">;
+	auto h = hasher_t{};
+
+	cthash::sha256_value output;
+	h.update("a").hash_into(output);
+	REQUIRE(output == cthash::sha256{}.update("prefix:a").final());
+
+	h.update("b").hash_into(output);
+	REQUIRE(output == cthash::sha256{}.update("prefix:b").final());
+
+	REQUIRE(h.update("zzz").reset().update("c").final() == cthash::sha256{}.update("prefix:c").final());
+}
@@ -120,6 +120,16 @@ TEST_CASE("sha256 basics (constexpr and runtime)") {
 	REQUIRE(v5 == v5r);
 }
 
+TEST_CASE("sha256 constexpr and runtime over multiple blocks") {
+	// constant evaluation has its own code path, so it's checked with data where byte order matters
+	constexpr auto input = counting_bytes<1000>(0u, 7u);
+
+	constexpr auto v1 = cthash::sha256{}.update(input).final();
+	const auto v1r = cthash::sha256{}.update(runtime_pass(input)).final();
+	REQUIRE(v1 == "89f4ff56a25dd1db06a4ce6033603775d705fb96f30f8693733fef602a1ca532"_sha256);
+	REQUIRE(v1 == v1r);
+}
+
 TEST_CASE("sha256 long hash over 512MB", "[.long]") {
 	cthash::sha256 h{};
 	for (int i = 0; i != 512 * 1024; ++i) {
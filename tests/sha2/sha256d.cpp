@@ -0,0 +1,81 @@
+#include "../internal/support.hpp"
+#include <cthash/sha2/sha256d.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+namespace {
+
+// bitcoin genesis block header
+constexpr auto genesis = cthash::hash_value{"0100000000000000000000000000000000000000000000000000000000000000000000003ba3edfd7a7b12b27ac72c3e67768f617fc81bc3888a51323a9fb8aa4b1e5e4a29ab5f49ffff001d1dac2b7c"};
+constexpr uint32_t genesis_nonce = 2083236893u;
+
+auto header_with_nonce(uint32_t nonce) {
+	std::array<std::byte, 80> header;
+	std::copy(genesis.begin(), genesis.end(), header.begin());
+	cthash::unwrap_littleendian_number<uint32_t>{std::span(header).last<4>()} = nonce;
+	return header;
+}
+
+// only most significant byte (last one) is limited
+auto easy_target(uint8_t top) {
+	auto target = cthash::hash_value<32>{};
+	std::fill(target.begin(), target.end(), std::byte{0xFF});
+	target[31] = static_cast<std::byte>(top);
+	return target;
+}
+
+} // namespace
+
+TEST_CASE("sha256d (constexpr)") {
+	constexpr auto v1 = cthash::sha256d{}.update("abc").final();
+	STATIC_REQUIRE(v1 == "4f8b42c22dd3729b519ba6f68d2da7cc5b2d606d05daed5ad5128cc03e6c6358"_sha256);
+
+	constexpr auto v2 = cthash::sha256d{}.final();
+	STATIC_REQUIRE(v2 == "5df6e0e2761359d30a8275058e299fcc0381534545f55cf43e41983f5d4c9456"_sha256);
+}
+
+TEST_CASE("sha256d") {
+	REQUIRE(cthash::sha256d{}.update(std::string(1000u, 'x')).final() == "53d88e205023545961a1ef7a5a676316ffe4abbaa236738e7cc14bcb483746d6"_sha256);
+	REQUIRE(cthash::sha256d{}.update(genesis).final() == "6fe28c0ab6f1b372c1a6a246ae63f74f931e8365e15a089c68d6190000000000"_sha256);
+}
+
+TEST_CASE("sha256d header sweep finds genesis nonce") {
+	// difficulty 1 target from bits 0x1d00ffff
+	const auto target = cthash::hash_value{"0000000000000000000000000000000000000000000000000000ffff00000000"};
+	const auto header = header_with_nonce(0u);
+
+	REQUIRE(cthash::sha256d_header_sweep(header, {genesis_nonce - 1000u, genesis_nonce + 1000u}, target) == genesis_nonce);
+	REQUIRE(cthash::sha256d_header_sweep<16>(header, {genesis_nonce - 3u, genesis_nonce + 1u}, target) == genesis_nonce);
+
+	// range ends just before it
+	REQUIRE(cthash::sha256d_header_sweep(header, {genesis_nonce - 1000u, genesis_nonce}, target) == std::nullopt);
+	REQUIRE(cthash::sha256d_header_sweep<1>(header, {genesis_nonce, genesis_nonce + 1u}, target) == genesis_nonce);
+}
+
+TEST_CASE("sha256d header sweep same as sha256d") {
+	const auto target = easy_target(0x0Fu);
+
+	// first nonce found by hashing headers one by one
+	const auto expected = [&]() -> std::optional<uint32_t> {
+		for (uint32_t nonce = 0xFFFFFF00u; nonce != 0u; ++nonce) {
+			const auto digest = cthash::sha256d{}.update(header_with_nonce(nonce)).final();
+			if (std::lexicographical_compare(digest.rbegin(), digest.rend(), target.rbegin(), target.rend()) || digest == target) {
+				return nonce;
+			}
+		}
+		return std::nullopt;
+	}();
+
+	REQUIRE(expected.has_value());
+
+	const auto header = header_with_nonce(0u);
+	const auto range = cthash::nonce_range{0xFFFFFF00u, uint64_t{1u} << 32u};
+
+	REQUIRE(cthash::sha256d_header_sweep(header, range, target) == expected);
+	REQUIRE(cthash::sha256d_header_sweep<16>(header, range, target) == expected);
+	REQUIRE(cthash::sha256d_header_sweep<1>(header, range, target) == expected);
+
+	// nothing is below zero
+	REQUIRE(cthash::sha256d_header_sweep(header, range, cthash::hash_value<32>{}) == std::nullopt);
+}
@@ -240,3 +240,13 @@ TEST_CASE("sha512 basics", "") {
 	REQUIRE(v6 == v6r);
 	REQUIRE(v6 == v6rb);
 }
+
+TEST_CASE("sha512 constexpr and runtime over multiple blocks") {
+	// constant evaluation has its own code path, so it's checked with data where byte order matters
+	constexpr auto input = counting_bytes<1000>(0u, 7u);
+
+	constexpr auto v1 = cthash::sha512{}.update(input).final();
+	const auto v1r = cthash::sha512{}.update(runtime_pass(input)).final();
+	REQUIRE(v1 == "5c3d2be85b82f8ace3dbd4cf34e814cf68201a9f3e5730253ee42fd46fbe6db2e68ab158e76a103df431f3ad279d8fa3ff6b148e21ced56feb321a6d28d101f1"_sha512);
+	REQUIRE(v1 == v1r);
+}
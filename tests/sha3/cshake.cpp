@@ -0,0 +1,51 @@
+#include "../internal/support.hpp"
+#include <cthash/sha3/cshake.hpp>
+#include <cthash/sha3/shake128.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+TEST_CASE("left_encode / right_encode") {
+	STATIC_REQUIRE(cthash::internal::left_encode(0u).length == 2u);
+	STATIC_REQUIRE(cthash::internal::left_encode(0u).buffer[0] == std::byte{1});
+	STATIC_REQUIRE(cthash::internal::left_encode(0u).buffer[1] == std::byte{0});
+
+	constexpr auto l = cthash::internal::left_encode(0x1234u);
+	STATIC_REQUIRE(l.length == 3u);
+	STATIC_REQUIRE(l.buffer[0] == std::byte{2});
+	STATIC_REQUIRE(l.buffer[1] == std::byte{0x12});
+	STATIC_REQUIRE(l.buffer[2] == std::byte{0x34});
+
+	constexpr auto r = cthash::internal::right_encode(168u);
+	STATIC_REQUIRE(r.length == 2u);
+	STATIC_REQUIRE(r.buffer[0] == std::byte{168});
+	STATIC_REQUIRE(r.buffer[1] == std::byte{1});
+
+	constexpr auto big = cthash::internal::right_encode(~uint64_t{0});
+	STATIC_REQUIRE(big.length == 9u);
+	STATIC_REQUIRE(big.buffer[8] == std::byte{8});
+}
+
+TEST_CASE("cshake128 NIST sample (constexpr)") {
+	constexpr auto r = cthash::cshake128<"Email Signature">{}.update(counting_bytes<4>()).final<256>();
+	STATIC_REQUIRE(r == "c1c36925b6409a04f1b504fcbca9d82b4017277cb5ed2b2065fc1d3814d5aaf5"_hash);
+}
+
+TEST_CASE("cshake256 NIST sample") {
+	const auto r = cthash::cshake256<"Email Signature">{}.update(counting_bytes<200>()).final<512>();
+	REQUIRE(r == "07dc27b11e51fbac75bc7b3c1d983e8b4b85fb1defaf218912ac86430273091727f42b17ed1df63e8ec118f04b23633c1dfb1574c8fb55cb45da8e25afb092bb"_hash);
+}
+
+TEST_CASE("cshake with empty strings is shake") {
+	STATIC_REQUIRE(std::same_as<cthash::cshake128<>::super, cthash::shake128>);
+
+	const auto r = cthash::cshake128<>{}.update("The quick brown fox jumps over the lazy dog").final<256>();
+	REQUIRE(r == cthash::shake128{}.update("The quick brown fox jumps over the lazy dog").final<256>());
+}
+
+TEST_CASE("cshake reset goes back to customized state") {
+	auto h = cthash::cshake128<"Email Signature">{};
+	h.update("something else");
+	h.reset();
+	REQUIRE(h.update(counting_bytes<4>()).final<256>() == "c1c36925b6409a04f1b504fcbca9d82b4017277cb5ed2b2065fc1d3814d5aaf5"_hash);
+}
@@ -0,0 +1,47 @@
+#include "../internal/support.hpp"
+#include <cthash/sha3/keccak-fixed.hpp>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+TEST_CASE("keccak_256_fixed (constexpr)") {
+	// storage slot zero and hash of two zero words
+	STATIC_REQUIRE(cthash::keccak_256_fixed<32>(array_of_zeros<32>()) == "290decd9548b62a8d60345a988386fc84ba6bc95484008f6362f93160ef3e563"_keccak_256);
+	STATIC_REQUIRE(cthash::keccak_256_fixed<64>(array_of_zeros<64>()) == "ad3228b676f7d3cd4284a5443f17f1962b36e491b30a40b2405849e597ba5fb5"_keccak_256);
+	STATIC_REQUIRE(cthash::keccak_256_fixed<64>(counting_bytes<64>()) == "002030bde3d4cf89919649775cd71875c4d0ab1708a380e03fefc3a28aa24831"_keccak_256);
+}
+
+TEST_CASE("keccak_256_fixed of unaligned size") {
+	const auto in = counting_bytes<20>();
+	REQUIRE(cthash::keccak_256_fixed<20>(in) == cthash::keccak_256{}.update(in).final());
+
+	const auto digest = cthash::keccak_256{}.update("hello").final();
+	REQUIRE(cthash::keccak_256_fixed(digest) == cthash::keccak_256{}.update(digest).final());
+}
+
+TEST_CASE("keccak_256_many same as one by one") {
+	std::vector<std::array<std::byte, 64>> inputs{};
+	for (size_t i = 0; i != 37u; ++i) {
+		inputs.push_back(counting_bytes<64>(i));
+	}
+
+	std::vector<cthash::keccak_256_value> outputs(inputs.size());
+	cthash::keccak_256_many(std::span<const std::array<std::byte, 64>>(inputs), std::span<cthash::keccak_256_value>(outputs));
+
+	for (size_t i = 0; i != inputs.size(); ++i) {
+		REQUIRE(outputs[i] == cthash::keccak_256{}.update(inputs[i]).final());
+	}
+}
+
+TEST_CASE("keccak_256_lanes of different sizes") {
+	const auto data = counting_bytes<300>();
+	const auto in = std::span<const std::byte>(data);
+
+	const auto inputs = std::array{in.first(0), in.first(135), in.first(136), in};
+	const auto outputs = cthash::keccak_256_lanes(inputs);
+
+	for (size_t i = 0; i != inputs.size(); ++i) {
+		REQUIRE(outputs[i] == cthash::keccak_256{}.update(inputs[i]).final());
+	}
+}
@@ -0,0 +1,48 @@
+#include "../internal/support.hpp"
+#include <cthash/sha3/kmac.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+namespace {
+
+constexpr auto key = counting_bytes<32>(0x40u);
+
+} // namespace
+
+TEST_CASE("kmac128 NIST samples (constexpr)") {
+	constexpr auto a = cthash::kmac128<>{key}.update(counting_bytes<4>()).final<256>();
+	STATIC_REQUIRE(a == "e5780b0d3ea6f7d3a429c5706aa43a00fadbd7d49628839e3187243f456ee14e"_hash);
+
+	constexpr auto b = cthash::kmac128<"My Tagged Application">{key}.update(counting_bytes<4>()).final<256>();
+	STATIC_REQUIRE(b == "3b1fba963cd8b0b59e8c1a6d71888b7143651af8ba0a7070c0979e2811324aa5"_hash);
+}
+
+TEST_CASE("kmac256 NIST sample") {
+	const auto r = cthash::kmac256<"My Tagged Application">{key}.update(counting_bytes<200>()).final<512>();
+	REQUIRE(r == "b58618f71f92e1d56c1b8c55ddd7cd188b97b4ca4d99831eb2699a837da2e4d970fbacfde50033aea585f1a2708510c32d07880801bd182898fe476876fc8965"_hash);
+}
+
+TEST_CASE("kmac keyed state is reusable") {
+	const auto keyed = cthash::kmac128<"My Tagged Application">{key};
+
+	std::array<std::byte, 32> output;
+	auto copy = keyed;
+	copy.update(counting_bytes<2>()).update(counting_bytes<2>(2u)).final(output);
+
+	REQUIRE(cthash::hash_value<32>(std::move(output)) == "3b1fba963cd8b0b59e8c1a6d71888b7143651af8ba0a7070c0979e2811324aa5"_hash);
+	auto copy2 = keyed;
+	REQUIRE(copy2.update(counting_bytes<4>()).final<256>() == "3b1fba963cd8b0b59e8c1a6d71888b7143651af8ba0a7070c0979e2811324aa5"_hash);
+}
+
+TEST_CASE("kmac output length is part of the mac") {
+	const auto short_mac = cthash::kmac128<>{key}.update("message").final<128>();
+	const auto long_mac = cthash::kmac128<>{key}.update("message").final<256>();
+	REQUIRE(!std::equal(short_mac.begin(), short_mac.end(), long_mac.begin()));
+
+	// KMACXOF is prefix-stable
+	auto reader = cthash::kmac128<>{key}.update("message").finalize_xof();
+	const auto a = reader.read<16>();
+	const auto b = cthash::kmac128<>{key}.update("message").finalize_xof().read<32>();
+	REQUIRE(std::equal(a.begin(), a.end(), b.begin()));
+}
@@ -0,0 +1,68 @@
+#include "../internal/support.hpp"
+#include <cthash/sha3/parallelhash.hpp>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+namespace {
+
+constexpr auto sample = std::array<std::byte, 24>{
+	std::byte{0x00}, std::byte{0x01}, std::byte{0x02}, std::byte{0x03}, std::byte{0x04}, std::byte{0x05}, std::byte{0x06}, std::byte{0x07},
+	std::byte{0x10}, std::byte{0x11}, std::byte{0x12}, std::byte{0x13}, std::byte{0x14}, std::byte{0x15}, std::byte{0x16}, std::byte{0x17},
+	std::byte{0x20}, std::byte{0x21}, std::byte{0x22}, std::byte{0x23}, std::byte{0x24}, std::byte{0x25}, std::byte{0x26}, std::byte{0x27}};
+
+auto generated_input(size_t n) {
+	std::vector<std::byte> output(n);
+	for (size_t i = 0; i != n; ++i) {
+		output[i] = static_cast<std::byte>(i * 7u + 3u);
+	}
+	return output;
+}
+
+} // namespace
+
+TEST_CASE("parallel_hash128 NIST samples (constexpr)") {
+	constexpr auto a = cthash::parallel_hash128<>{8u}.update(sample).final<256>();
+	STATIC_REQUIRE(a == "ba8dc1d1d979331d3f813603c67f72609ab5e44b94a0b8f9af46514454a2b4f5"_hash);
+
+	constexpr auto b = cthash::parallel_hash128<"Parallel Data">{8u}.update(sample).final<256>();
+	STATIC_REQUIRE(b == "fc484dcb3f84dceedc353438151bee58157d6efed0445a81f165e495795b7206"_hash);
+}
+
+TEST_CASE("parallel_hash256 NIST sample") {
+	const auto r = cthash::parallel_hash256<"Parallel Data">{8u}.update(sample).final<512>();
+	REQUIRE(r == "cdf15289b54f6212b4bc270528b49526006dd9b54e2b6add1ef6900dda3963bb33a72491f236969ca8afaea29c682d47a393c065b38e29fae651a2091c833110"_hash);
+}
+
+TEST_CASE("parallel_hash in pieces and threads") {
+	const auto input = generated_input(100000u);
+	const auto view = std::span<const std::byte>(input);
+
+	const auto expected = "609eba60fa3432f02a4fda71c9964e245fe702a52ec85e537463f49dc60a812a"_hash;
+
+	REQUIRE(cthash::parallel_hash128<"x">{1000u}.update(view).final<256>() == expected);
+	REQUIRE(cthash::parallel_hash128<"x">{1000u, 4u}.update(view).final<256>() == expected);
+
+	// buffering across updates of various sizes
+	for (size_t piece: {1u, 999u, 1000u, 3001u, 4000u, 77777u}) {
+		auto h = cthash::parallel_hash128<"x">{1000u};
+		for (size_t offset = 0; offset < view.size(); offset += piece) {
+			h.update(view.subspan(offset, std::min(piece, view.size() - offset)));
+		}
+		REQUIRE(h.final<256>() == expected);
+	}
+
+	// blocks bigger than rate, with threads
+	REQUIRE(cthash::parallel_hash256<>{8192u, 3u}.update(view).final<512>() == "e6edba2e4a0f96ec0d76f75820a4a10667f9d5bbd192b0248979352c60004e7d1b8fd049ce406e23ff18dfa4ab62d5e6442fcb25c8009775746881a3cb9d5f74"_hash);
+
+	// small blocks, enough of them to be split across all threads
+	REQUIRE(cthash::parallel_hash128<>{200u}.update(view.first(5000u)).final<256>() == "4738ec4ee5ea0d244ead26c62a0da73ab0147df1e107b03f39e9aec04cc72b46"_hash);
+	REQUIRE(cthash::parallel_hash128<>{200u, 4u}.update(view).final<256>() == "9c8db4f08f0f8226e97b0dc72c15717d13d814d1fdfab69e2ccc464453a98f0d"_hash);
+}
+
+TEST_CASE("parallel_hash xof") {
+	const auto input = generated_input(100000u);
+	auto reader = cthash::parallel_hash128<"x">{1000u}.update(std::span<const std::byte>(input)).finalize_xof();
+	REQUIRE(cthash::hash_value<32>(reader.read<32>()) == "5444c9b350247874534cbd2f81765b2b133f19409621f308f4498b849cc77927"_hash);
+}
@@ -101,6 +101,16 @@ TEST_CASE("sha3-256 test strings") {
 	}
 }
 
+TEST_CASE("sha3-256 constexpr and runtime over multiple blocks") {
+	// constant evaluation has its own code path, so it's checked with data where byte order matters
+	constexpr auto input = counting_bytes<1000>(0u, 7u);
+
+	constexpr auto v1 = cthash::sha3_256{}.update(input).final();
+	const auto v1r = cthash::sha3_256{}.update(runtime_pass(input)).final();
+	REQUIRE(v1 == "dff46ff5ed9e8d28b7048f3a3e3adba1d3c5c73ac196b0de15d8081937376279"_sha3_256);
+	REQUIRE(v1 == v1r);
+}
+
 TEST_CASE("sha3-256 stability") {
 	auto h = cthash::sha3_256();
 
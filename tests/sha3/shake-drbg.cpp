@@ -0,0 +1,78 @@
+#include "../internal/support.hpp"
+#include <cthash/sha3/shake-drbg.hpp>
+#include <random>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+static_assert(std::uniform_random_bit_generator<cthash::shake128_drbg>);
+static_assert(std::uniform_random_bit_generator<cthash::shake256_drbg>);
+
+TEST_CASE("shake_drbg (constexpr)") {
+	constexpr auto value = cthash::shake128_drbg{"The quick brown fox jumps over the lazy dog"}.uniform<uint16_t>();
+
+	// first two bytes of shake128 of the seed (little-endian)
+	STATIC_REQUIRE(value == 0x20f4u);
+}
+
+TEST_CASE("shake_drbg is same as shake output") {
+	const auto expected = cthash::shake256{}.update("seed").final<8000>();
+
+	auto drbg = cthash::shake256_drbg{"seed"};
+	std::vector<std::byte> output(1000u);
+
+	// pieces of various sizes, and numbers
+	drbg.generate(std::span(output).first(3u));
+	drbg.generate(std::span(output).subspan(3u, 136u));
+	const uint64_t number = drbg();
+	drbg.generate(std::span(output).subspan(147u));
+
+	REQUIRE(std::equal(output.begin(), output.begin() + 139, expected.begin()));
+	REQUIRE(number == cthash::cast_from_le_bytes<uint64_t>(std::span<const std::byte, 8>(expected.data() + 139, 8u)));
+	REQUIRE(std::equal(output.begin() + 147, output.end(), expected.begin() + 147));
+}
+
+TEST_CASE("shake_drbg with random distributions") {
+	auto a = cthash::shake128_drbg{"seed"};
+	auto b = cthash::shake128_drbg{"seed"};
+	auto c = cthash::shake128_drbg{"another seed"};
+
+	std::uniform_int_distribution<int> dice{1, 6};
+	std::vector<int> ra, rb, rc;
+	for (int i = 0; i != 100; ++i) {
+		ra.push_back(dice(a));
+		rb.push_back(dice(b));
+		rc.push_back(dice(c));
+	}
+
+	REQUIRE(ra == rb);
+	REQUIRE(ra != rc);
+	REQUIRE(std::ranges::all_of(ra, [](int v) { return v >= 1 && v <= 6; }));
+}
+
+TEST_CASE("shake_drbg_streams are same as separate generators") {
+	auto streams = cthash::shake_drbg_streams<128u, 4u>{"seed"};
+
+	std::array<cthash::shake128_drbg, 4> separate = {streams.stream(0u), streams.stream(1u), streams.stream(2u), streams.stream(3u)};
+
+	std::array<std::vector<std::byte>, 4> together;
+	for (auto & v: together) {
+		v.resize(5000u);
+	}
+
+	streams.generate({together[0], together[1], together[2], together[3]});
+
+	for (size_t i = 0; i != 4u; ++i) {
+		std::vector<std::byte> expected(5000u);
+		separate[i].generate(expected);
+		REQUIRE(together[i] == expected);
+	}
+
+	// streams are seeded with seed || index
+	std::array<std::byte, 8> index{};
+	index[0] = std::byte{2};
+	const auto third = cthash::shake128{}.update("seed").update(std::span<const std::byte>(index)).final<256>();
+	REQUIRE(std::equal(third.begin(), third.end(), together[2].begin()));
+	REQUIRE(together[0] != together[1]);
+}
@@ -0,0 +1,27 @@
+#include "../internal/support.hpp"
+#include <cthash/sha3/tuplehash.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+TEST_CASE("tuple_hash128 NIST samples (constexpr)") {
+	constexpr auto a = cthash::tuple_hash128<>{}.add(counting_bytes<3>()).add(counting_bytes<6>(0x10u)).final<256>();
+	STATIC_REQUIRE(a == "c5d8786c1afb9b82111ab34b65b2c0048fa64e6d48e263264ce1707d3ffc8ed1"_hash);
+
+	constexpr auto b = cthash::tuple_hash128<"My Tuple App">{}.add(counting_bytes<3>()).add(counting_bytes<6>(0x10u)).final<256>();
+	STATIC_REQUIRE(b == "75cdb20ff4db1154e841d758e24160c54bae86eb8c13e7f5f40eb35588e96dfb"_hash);
+}
+
+TEST_CASE("tuple_hash256 NIST sample") {
+	const auto r = cthash::tuple_hash256<"My Tuple App">{}.add(counting_bytes<3>()).add(counting_bytes<6>(0x10u)).add(counting_bytes<9>(0x20u)).final<512>();
+	REQUIRE(r == "45000be63f9b6bfd89f54717670f69a9bc763591a4f05c50d68891a744bcc6e7d6d5b5e82c018da999ed35b0bb49c9678e526abd8e85c13ed254021db9e790ce"_hash);
+}
+
+TEST_CASE("tuple_hash element boundaries matter") {
+	const auto a = cthash::tuple_hash128<>{}.add("ab").add("c").final<256>();
+	const auto b = cthash::tuple_hash128<>{}.add("a").add("bc").final<256>();
+	const auto c = cthash::tuple_hash128<>{}.add(std::string_view{"ab"}).add(std::string{"c"}).final<256>();
+
+	REQUIRE(a != b);
+	REQUIRE(a == c);
+}
@@ -0,0 +1,70 @@
+#include "../internal/support.hpp"
+#include <cthash/sha3/shake128.hpp>
+#include <cthash/sha3/turboshake.hpp>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+namespace {
+
+auto generated_input(size_t n) {
+	std::vector<std::byte> output(n);
+	for (size_t i = 0; i != n; ++i) {
+		output[i] = static_cast<std::byte>(i % 251u);
+	}
+	return output;
+}
+
+} // namespace
+
+TEST_CASE("keccak_p with all rounds is keccak_f") {
+	constexpr auto check = [] {
+		cthash::keccak::state_1600 a{};
+		a[3] = 0x0123456789abcdefull;
+		auto b = a;
+		cthash::keccak::keccak_f(a);
+		cthash::keccak::keccak_p<24>(b);
+		return a == b;
+	}();
+
+	STATIC_REQUIRE(check);
+	STATIC_REQUIRE(cthash::shake128::rounds == 24u);
+	STATIC_REQUIRE(cthash::turboshake128<>::rounds == 12u);
+}
+
+TEST_CASE("turboshake128 (constexpr)") {
+	constexpr auto empty = cthash::turboshake128<>{}.final<256>();
+	STATIC_REQUIRE(empty == "1e415f1c5983aff2169217277d17bb538cd945a397ddec541f1ce41af2c1b74c"_hash);
+}
+
+TEST_CASE("turboshake128 with domain separation") {
+	const auto a = cthash::turboshake128<>{}.update("The quick brown fox jumps over the lazy dog").final<512>();
+	REQUIRE(a == "76a1720a4848ab64e67e563f16b8c5aa492b698a4d93429735fd02354657fbf7a0689ec77b4c795fda9daab410c63092f54200846c34120ff2b253e9fd8d9fc4"_hash);
+
+	const auto b = cthash::turboshake128<0x06u>{}.update("The quick brown fox jumps over the lazy dog").final<256>();
+	REQUIRE(b == "eb07633a6610a03e5dfb8f4f6e7dca7a39e0dff8aeff655769769d5b25582325"_hash);
+
+	const auto input = generated_input(1000u);
+	const auto c = cthash::turboshake128<0x0Bu>{}.update(std::span<const std::byte>(input)).final<256>();
+	REQUIRE(c == "4ae356603b5c623945d8b645ad14cbabc23a6a706b7ecc4f87033346600f408e"_hash);
+}
+
+TEST_CASE("turboshake256 and xof reader") {
+	const auto input = generated_input(1000u);
+	const auto expected = "f951c13e87766630265692dba8ca7202666b0b654bdbcf036e7676c7f43359fcb3df057f997264961311e88311afad57411f2d50c23194ff4b739adf6f7f9431"_hash;
+
+	REQUIRE(cthash::turboshake256<>{}.update(std::span<const std::byte>(input)).final<512>() == expected);
+
+	auto reader = cthash::turboshake256<>{}.update(std::span<const std::byte>(input)).finalize_xof();
+	const auto first = reader.read<24>();
+	const auto second = reader.read<40>();
+	REQUIRE(std::equal(first.begin(), first.end(), expected.begin()));
+	REQUIRE(std::equal(second.begin(), second.end(), expected.begin() + 24));
+}
+
+TEST_CASE("turboshake state export keeps number of rounds") {
+	const auto exported = cthash::turboshake128<>{}.update("abc").export_state();
+	REQUIRE(cthash::turboshake128<>::import_state(exported).has_value());
+	REQUIRE(!cthash::shake128::import_state(exported).has_value());
+}
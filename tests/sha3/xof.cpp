@@ -0,0 +1,59 @@
+#include "../internal/support.hpp"
+#include <cthash/sha3/shake128.hpp>
+#include <cthash/sha3/shake256.hpp>
+#include <vector>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace cthash::literals;
+
+TEST_CASE("xof_reader (constexpr)") {
+	constexpr auto output = [] {
+		auto reader = cthash::shake128{}.update("The quick brown fox jumps over the lazy dog").finalize_xof();
+		return reader.read<2>();
+	}();
+
+	STATIC_REQUIRE(output[0] == std::byte{0xf4});
+	STATIC_REQUIRE(output[1] == std::byte{0x20});
+}
+
+TEMPLATE_TEST_CASE("xof_reader same as final", "[xof]", cthash::shake128, cthash::shake256) {
+	constexpr size_t length = 2000u;
+	const auto expected = TestType{}.update("hello").template final<length * 8u>();
+
+	// pieces of various sizes crossing block boundaries
+	for (size_t piece: {1u, 7u, 8u, 100u, 136u, 168u, 500u, 2000u}) {
+		auto reader = TestType{}.update("hello").finalize_xof();
+		std::vector<std::byte> output(length);
+
+		for (size_t offset = 0; offset < length; offset += piece) {
+			reader.read(std::span(output).subspan(offset, std::min(piece, length - offset)));
+		}
+
+		REQUIRE(std::equal(output.begin(), output.end(), expected.begin()));
+	}
+}
+
+TEMPLATE_TEST_CASE("xof read_lanes same as separate readers", "[xof]", cthash::shake128, cthash::shake256) {
+	using reader_t = decltype(TestType{}.finalize_xof());
+
+	const auto make = [](int i) { return TestType{}.update(std::string(static_cast<size_t>(i), 'x')).finalize_xof(); };
+	auto batched = std::array<reader_t, 4>{make(0), make(1), make(2), make(3)};
+	auto separate = batched;
+
+	for (size_t length: {5u, 1000u, 0u, 168u, 3u, 700u}) {
+		std::array<std::vector<std::byte>, 4> a;
+		std::array<std::vector<std::byte>, 4> b;
+		std::array<std::span<std::byte>, 4> spans;
+
+		for (size_t l = 0; l != 4u; ++l) {
+			a[l].resize(length);
+			b[l].resize(length);
+			spans[l] = a[l];
+			separate[l].read(b[l]);
+		}
+
+		cthash::read_lanes(batched, spans);
+		REQUIRE(a == b);
+	}
+}
@@ -268,4 +268,35 @@ TEMPLATE_TEST_CASE("sha3 sequence of overwrites", "[xor]", std::byte, char) {
 	REQUIRE(h.internal_state[0] == 0x2A2A2A2A2A2A2A2Aull);
 	REQUIRE(h.internal_state[1] == 0x2Aull);
 	REQUIRE(h.internal_state[2] == 0ull);
-}
\ No newline at end of file
+}
+
+TEMPLATE_TEST_CASE("sha3 common absorb_block same as xor_overwrite_block", "[xor]", std::byte, char) {
+	using T = TestType;
+	using hasher_t = cthash::sha3_256;
+
+	std::array<T, hasher_t::rate> block;
+	for (size_t i = 0; i != block.size(); ++i) {
+		block[i] = static_cast<T>(i * 13u + 1u);
+	}
+
+	auto a = hasher_t{};
+	auto b = hasher_t{};
+	a.internal_state[3] = b.internal_state[3] = 0x0123456789ABCDEFull;
+
+	a.xor_overwrite_block(std::span<const T>(block));
+	b.absorb_block(std::span<const T, hasher_t::rate>(block));
+
+	REQUIRE(a.internal_state == b.internal_state);
+	REQUIRE(b.position == 0u);
+
+	constexpr auto first_lane = [] {
+		auto h = hasher_t{};
+		std::array<T, hasher_t::rate> in{};
+		in[0] = static_cast<T>(0x01u);
+		in[7] = static_cast<T>(0x80u);
+		h.absorb_block(std::span<const T, hasher_t::rate>(in));
+		return h.internal_state[0];
+	}();
+
+	STATIC_REQUIRE(first_lane == 0x8000000000000001ull);
+}
@@ -1,6 +1,8 @@
 #include <catch2/catch_test_macros.hpp>
+#include "internal/support.hpp"
 #include <cthash/value.hpp>
 #include <sstream>
+#include <unordered_set>
 
 using namespace cthash::literals;
 
@@ -60,3 +62,90 @@ TEST_CASE("hash stringification") {
 	auto v1 = cthash::hash_value{"00112233aabbccdd"};
 	REQUIRE(convert_to_string(v1) == "00112233aabbccdd");
 }
+
+TEST_CASE("hash_value fingerprint") {
+	constexpr auto v1 = cthash::hash_value{"0011223344556677aabbccdd"};
+
+	STATIC_REQUIRE(v1.fingerprint() == 0x0011223344556677ull);
+	STATIC_REQUIRE(v1.fingerprint<4>() == 0x00112233u);
+	STATIC_REQUIRE(v1.fingerprint<3>() == 0x001122u);
+	STATIC_REQUIRE(v1.fingerprint<1>() == 0x00u);
+	STATIC_REQUIRE(std::same_as<decltype(v1.fingerprint<2>()), uint16_t>);
+
+	constexpr auto v2 = cthash::hash_value{"aabbccdd"};
+	STATIC_REQUIRE(v2.fingerprint() == 0xaabbccddu);
+
+	// fingerprint keeps ordering of values
+	constexpr auto v3 = cthash::hash_value{"0011223344556678aabbccdd"};
+	STATIC_REQUIRE(v1 < v3);
+	STATIC_REQUIRE(v1.fingerprint() < v3.fingerprint());
+
+	REQUIRE(runtime_pass(v1).fingerprint() == 0x0011223344556677ull);
+	REQUIRE(runtime_pass(v1).fingerprint<3>() == 0x001122u);
+}
+
+TEST_CASE("hash_value std::hash support") {
+	const auto v1 = cthash::hash_value{"0011223344556677aabbccdd"};
+	const auto v2 = cthash::hash_value{"8899aabbccddeeff00112233"};
+
+	REQUIRE(std::hash<cthash::hash_value<12>>{}(v1) == static_cast<size_t>(0x0011223344556677ull));
+
+	std::unordered_set<cthash::hash_value<12>> set{};
+	set.insert(v1);
+	set.insert(v2);
+	set.insert(v1);
+
+	REQUIRE(set.size() == 2u);
+	REQUIRE(set.contains(v1));
+	REQUIRE(set.contains(v2));
+	REQUIRE(!set.contains(cthash::hash_value{"0011223344556677aabbccde"}));
+}
+
+TEST_CASE("hash_value comparison (word-wise)") {
+	constexpr auto v1 = cthash::hash_value{"00112233445566778899aabbccddeeff0011"};
+	constexpr auto v2 = cthash::hash_value{"00112233445566778899aabbccddeeff0012"};
+	constexpr auto v3 = cthash::hash_value{"00112233445566ff8899aabbccddeeff0010"};
+
+	STATIC_REQUIRE(v1 < v2);
+	STATIC_REQUIRE(v2 < v3);
+	STATIC_REQUIRE(std::is_eq(v1 <=> v1));
+
+	REQUIRE(runtime_pass(v1) < runtime_pass(v2));
+	REQUIRE(runtime_pass(v2) < runtime_pass(v3));
+	REQUIRE(runtime_pass(v3) > runtime_pass(v1));
+	REQUIRE(std::is_eq(runtime_pass(v3) <=> runtime_pass(v3)));
+
+	// byte order, not native integer order
+	REQUIRE(cthash::hash_value{"01000000000000000000"} > cthash::hash_value{"00ff0000000000000000"});
+	REQUIRE(cthash::hash_value{"00000000000000000001"} > cthash::hash_value{"00000000000000000000"});
+}
+
+TEST_CASE("hash_value equality (word-wise)") {
+	constexpr auto v1 = cthash::hash_value{"00112233445566778899aabbccddeeff00112233445566778899aabbccddeeff0011"};
+	constexpr auto v2 = cthash::hash_value{"00112233445566778899aabbccddeeff00112233445566778899aabbccddeeff0012"};
+
+	STATIC_REQUIRE(v1 == v1);
+	STATIC_REQUIRE(v1 != v2);
+	STATIC_REQUIRE(cthash::constant_time_equal(v1, v1));
+	STATIC_REQUIRE(!cthash::constant_time_equal(v1, v2));
+
+	// difference at every position
+	for (size_t i = 0; i != v1.size(); ++i) {
+		auto copy = v1;
+		copy[i] ^= std::byte{0x80};
+
+		REQUIRE(runtime_pass(copy) != runtime_pass(v1));
+		REQUIRE(!cthash::constant_time_equal(runtime_pass(copy), runtime_pass(v1)));
+
+		copy[i] ^= std::byte{0x80};
+
+		REQUIRE(runtime_pass(copy) == runtime_pass(v1));
+		REQUIRE(cthash::constant_time_equal(runtime_pass(copy), runtime_pass(v1)));
+	}
+
+	// sizes which are not multiple of word
+	REQUIRE(cthash::hash_value{"001122"} == cthash::hash_value{"001122"});
+	REQUIRE(cthash::hash_value{"001122"} != cthash::hash_value{"001123"});
+	REQUIRE(cthash::constant_time_equal(cthash::hash_value{"00112233445566778899"}, cthash::hash_value{"00112233445566778899"}));
+	REQUIRE(!cthash::constant_time_equal(cthash::hash_value{"00112233445566778899"}, cthash::hash_value{"00112233445566778898"}));
+}
@@ -194,6 +194,14 @@ TEST_CASE("xxhash_fnc basics", "[xxh]") {
 	}
 }
 
+TEST_CASE("xxhash update_and_final_value", "[xxh-basic]") {
+	using namespace std::string_view_literals;
+
+	STATIC_REQUIRE(cthash::xxhash<32>{}.update_and_final_value("hello there"sv) == 0x371c3e72u);
+	STATIC_REQUIRE(cthash::xxhash<64>{}.update_and_final_value("hello there"sv) == 0x08f296af889a203cu);
+	STATIC_REQUIRE(cthash::xxhash<64>{42u}.update_and_final_value("hello there, from somehow long string! really this should be enought :)"sv) == 0x62eee52b8dbf7af9u);
+}
+
 TEST_CASE("xxhash_fnc benchmarks", "[xxh]") {
 	auto val = std::string(10u * 1024u * 1024u, '*');
 